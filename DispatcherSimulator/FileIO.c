@@ -11,15 +11,17 @@
 /*          Mario García Navarro                                         */
 /*                                                                       */
 /* Purpose:                                                              */
-/*          Support routines that handle reading ASCII files             */
+/*          Support routines that handle reading ASCII files, and the    */
+/*          binary columnar files converted from them                    */
 /*                                                                       */
 /* References:                                                           */
 /*          Based on my own code, but won't be surprised if it is        */
 /*          similar to other code out there                              */
 /*                                                                       */
 /* Restrictions:                                                         */
-/*          All functions return EXIT_FAILURE in case something went     */
-/*          wrong                                                        */
+/*          The numbers must fit in an int. Only digits, white space,    */
+/*          comments, a minus sign before a number and the separator |   */
+/*          are accepted                                                 */
 /*                                                                       */
 /* Revision history:                                                     */
 /*          Feb  4 15:15 2011 - File created                             */
@@ -28,67 +30,645 @@
 /*                                                                       */
 /*          Sep 22 00:55 2014 - Edited messages                          */
 /*                                                                       */
+/*          Oct 17 09:10 2026 - Added the pre-scan that counts processes */
+/*                                                                       */
+/*          Oct 17 13:30 2026 - GetInt replaced by a block reader that   */
+/*                              parses eight digits at a time            */
+/*                                                                       */
+/*          Oct 17 16:20 2026 - Added the binary workload format, which  */
+/*                              is mapped in memory instead of parsed    */
+/*                                                                       */
+/*          Oct 17 23:55 2026 - A number can be looked for in the rest   */
+/*                              of a line, for the optional deadlines    */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - A separator can be looked for in the     */
+/*                              rest of a line, before the I/O cycles    */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The quantum of a binary workload must be */
+/*                              positive                                 */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The arrival times and CPU bursts of a    */
+/*                              binary workload are checked like the     */
+/*                              ones of a text workload                  */
+/*                                                                       */
 /* Error handling:                                                       */
-/*          None                                                         */
+/*          ReadInt reports the errors through it's return value, and    */
+/*          keeps the message, line and column of the error in the       */
+/*          reader                                                       */
 /*                                                                       */
 /* Notes:                                                                */
-/*          Support routine that reads an ASCII file and returns an      */
-/*          integer value skiping over non-numeric data                  */
+/*          Support routines that read an ASCII file in big blocks and   */
+/*          return the integer values, skiping over the comments         */
 /*                                                                       */
 /*************************************************************************/
 
-#include <stdlib.h>              /* Used for getc() and feof() functions */
-#include <ctype.h>                    /* Used for the isdigit() function */
+#include <stdlib.h>           /* Used for the memory allocation functions */
+#include <string.h>                 /* Used for memchr() and memmove() */
+#include <limits.h>                         /* Used for INT_MAX and INT_MIN */
 #include <stdio.h>                       /* Used to handle the FILE type */
+#include <fcntl.h>                          /* Used for the open function */
+#include <unistd.h>                          /* Used for the close function */
+#include <sys/mman.h>                           /* Used for mmap and munmap */
+#include <sys/stat.h>             /* Used to know the size of the file */
 #include "FileIO.h"                                   /* Function header */
 
+#define SCANBLOCK 65536     /* Size of the blocks read by CountProcesses */
+#define READBLOCK (1 << 20)     /* Size of the blocks read by the reader */
+#define MAXNUMBER 32     /* Characters that must be in the buffer before a
+                                            number is parsed, if possible */
+#define PADDING 8   /* Bytes after the data, so eight of them can always
+                                                       be read at once */
+
+/* Eight digits are parsed at once when the bytes of a word are in little
+ endian order, otherwise one digit at a time */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SWARDIGITS 1
+#else
+#define SWARDIGITS 0
+#endif
+
+enum characterClasses {OTHER = 0, BLANK, NEWLINE, COMMENT, SEPARATOR};
+
+/* The class of every character, so the white space is found with a
+ single lookup */
+static const unsigned char characterClass[256] = {
+    ['\t'] = BLANK, ['\v'] = BLANK, ['\f'] = BLANK, ['\r'] = BLANK, [' '] = BLANK,
+    ['\n'] = NEWLINE, ['#'] = COMMENT, ['|'] = SEPARATOR
+};
+
 /*************************************************************************/
 /*                                                                       */
-/*  Function: GetInt                                                     */
+/*  Function: FillReader                                                 */
 /*                                                                       */
-/*  Purpose: The function will read the input file and return an integer */
-/*           representing the ASCII characters that form a number. It    */
-/*           skips over comments, which begin a line with a #, and other */
-/*           ASCI characters that do not represent numbers               */
+/*  Purpose: Moves the characters that have not been parsed yet to the   */
+/*           beginning of the buffer and fills the rest of it with the   */
+/*           next block of the file                                      */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   Pointer to the text file to parse                */
+/*            Input :   The reader                                       */
 /*                                                                       */
-/*            Output:   Integer representing value, only positive values */
-/*                      are possible. If the end of file is reached, a   */
-/*                      -1 is returned                                   */
+/*            Output:   The number of characters that were read          */
 /*                                                                       */
 /*************************************************************************/
+static size_t FillReader(struct workloadReader *reader){
+    size_t left = reader->length - reader->position;  /* Not parsed yet */
+    size_t read;                            /* Characters that were read */
+    
+    if (reader->endOfFile)
+        return 0;
+    
+    memmove(reader->buffer, reader->buffer + reader->position, left);
+    reader->offset += reader->position;
+    reader->position = 0;
+    
+    read = fread(reader->buffer + left, 1, READBLOCK - left, reader->fp);
+    if (read < READBLOCK - left)
+        reader->endOfFile = 1;
+    
+    reader->length = left + read;
+    memset(reader->buffer + reader->length, 0, PADDING);
+    
+    return read;
+}
 
-int GetInt (FILE *fp){
-    int	c, i;         /* Character read and integer representation of it */
-    int sign = 1;
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReaderError                                                */
+/*                                                                       */
+/*  Purpose: Keeps the message and the place of an error in the reader   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and the error message                 */
+/*                                                                       */
+/*            Output:   The error status, -1                             */
+/*                                                                       */
+/*************************************************************************/
+static int ReaderError(struct workloadReader *reader, const char *message){
+    reader->error = message;
+    reader->errorLine = reader->line;
+    reader->errorColumn = (int)(reader->offset + reader->position - reader->lineStart) + 1;
     
-     /* Skip the comment */
-    do {
-        c = getc (fp);                          /* Get next character */
-        if ( c == '#' )
-            do {
-                c = getc (fp);
-            } while ( c != '\n');
-         /* This is for take account the negative sign, in case the number has */
-        if ( c == '-')
-            sign = -1;
-    } while (!isdigit(c) && !feof(fp));
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenReader                                                 */
+/*                                                                       */
+/*  Purpose: Prepares a reader for an open file                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and the file to parse                 */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE if the memory for  */
+/*                      the buffer can not be obtained                   */
+/*                                                                       */
+/*************************************************************************/
+int OpenReader (struct workloadReader *reader, FILE *fp){
+    memset(reader, 0, sizeof(*reader));
     
-    if (feof(fp))
+    reader->buffer = malloc(READBLOCK + PADDING);
+    if (!reader->buffer)
         return (EXIT_FAILURE);
-    else {
+    
+    reader->fp = fp;
+    reader->line = 1;
+    FillReader(reader);
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CloseReader                                                */
+/*                                                                       */
+/*  Purpose: Releases the buffer of a reader. The file is not closed     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader                                       */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void CloseReader (struct workloadReader *reader){
+    free(reader->buffer);
+    reader->buffer = NULL;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ParseDigits                                                */
+/*                                                                       */
+/*  Purpose: Converts the digits at the beginning of a string. When it   */
+/*           is possible, eight characters are loaded in a word, the     */
+/*           digits among them are found with a few arithmetic           */
+/*           operations and converted together, without a branch for     */
+/*           every digit                                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The string, which must have at least eight       */
+/*                      readable bytes, and where to store the value     */
+/*                                                                       */
+/*            Output:   The number of digits parsed                      */
+/*                                                                       */
+/*************************************************************************/
+static int ParseDigits(const char *text, unsigned long long *value){
+#if SWARDIGITS
+    unsigned long long word, digits, nonDigits;   /* Eight characters */
+    int length;                          /* Digits at the start of word */
+    
+    memcpy(&word, text, sizeof(word));
+    digits = word - 0x3030303030303030ULL;
+    
+    /* The high bit of a byte is set if it is not a digit: either it was
+     lower than '0' or it is greater than '9' */
+    nonDigits = (digits | (digits + 0x7676767676767676ULL)) & 0x8080808080808080ULL;
+    length = nonDigits ? __builtin_ctzll(nonDigits) / 8 : 8;
+    
+    if (length == 0)
+        return 0;
+    
+    /* Drop the characters after the number, so they count as leading zeros, and combine the digits in pairs, fours and eights */
+    digits = (digits << (8 * (8 - length))) & 0x0F0F0F0F0F0F0F0FULL;
+    digits = (digits * 2561) >> 8;
+    digits = ((digits & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    *value = ((digits & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+    
+    return length;
+#else
+    int length = 0;                          /* Digits found in the text */
+    
+    *value = 0;
+    while (length < 8 && text[length] >= '0' && text[length] <= '9'){
+        *value = *value * 10 + (unsigned long long)(text[length] - '0');
+        length++;
+    }
+    
+    return length;
+#endif
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadInt                                                    */
+/*                                                                       */
+/*  Purpose: The function will return the next integer of the file. It   */
+/*           skips over white space and comments, which begin with a #   */
+/*           and end with the line. Any other character is an error      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and where to store the value          */
+/*                                                                       */
+/*            Output:   1 if a number was read, 0 if the end of file was */
+/*                      reached, or -1 if there is an error. The message */
+/*                      and the place of the error are kept in the       */
+/*                      reader                                           */
+/*                                                                       */
+/*************************************************************************/
+int ReadInt (struct workloadReader *reader, int *value){
+    unsigned long long number = 0, part;   /* The value without the sign */
+    size_t start;                  /* Where the number starts in the buffer */
+    int negative = 0;                      /* Is the number negative? */
+    int length, digits = 0;               /* Digits parsed in the number */
+    
+    if (reader->error)
+        return (-1);
+    
+    /* Skip the white space and the comments */
+    for (;;){
+        const unsigned char *text = (const unsigned char *)reader->buffer; /* Scanning the buffer */
+        size_t position = reader->position;
+        char *newLine;
+        
+        /* Most of the characters between two numbers are blanks */
+        while (position < reader->length && characterClass[text[position]] == BLANK)
+            position++;
+        reader->position = position;
         
-    /* Found 1st digit, begin conversion until a non-digit is found */
-        i = 0;
-        while (isdigit (c) && !feof(fp)){
-            i = (i * 10) + (c - '0');         /* ASCII conversion */
-            c = getc (fp);
+        if (position == reader->length){
+            if (FillReader(reader) == 0)
+                return 0;
+        }
+        else if (characterClass[text[position]] == NEWLINE){
+            reader->line++;
+            reader->lineStart = reader->offset + position + 1;
+            reader->position++;
+        }
+        else if (characterClass[text[position]] == COMMENT){
+            /* The whole comment is skipped at once, even if it continues
+             in the next block */
+            while (!(newLine = memchr(reader->buffer + reader->position, '\n', reader->length - reader->position))){
+                reader->position = reader->length;
+                if (FillReader(reader) == 0)
+                    return 0;
+            }
+            reader->position = (size_t)(newLine - reader->buffer);
         }
+        else
+            break;
+    }
+    
+    /* Make sure that the whole number is in the buffer */
+    if (reader->length - reader->position < MAXNUMBER)
+        FillReader(reader);
+    
+    start = reader->position;
+    if (reader->buffer[reader->position] == '-'){
+        negative = 1;
+        reader->position++;
+    }
+    
+    while ((length = ParseDigits(reader->buffer + reader->position, &part)) > 0){
+        digits += length;
+        if (digits > 10){
+            reader->position = start;
+            return ReaderError(reader, "The number is out of range");
+        }
+        
+        for (int i = 0; i < length; i++)
+            number *= 10;
+        number += part;
+        reader->position += length;
+        
+        if (length < 8)
+            break;
+    }
+    
+    if (digits == 0)
+        return ReaderError(reader, negative ? "A digit was expected after the minus sign" : "Unexpected character");
+    if (number > (negative ? -(unsigned long long)INT_MIN : (unsigned long long)INT_MAX)){
+        reader->position = start;
+        return ReaderError(reader, "The number is out of range");
+    }
+    
+    /* The number must end with white space, a comment, a separator or the end of file */
+    if (characterClass[(unsigned char)reader->buffer[reader->position]] == OTHER && reader->position < reader->length)
+        return ReaderError(reader, "Unexpected character");
+    
+    *value = negative ? (int)(0 - number) : (int)number;
+    return 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: NextInLine                                                 */
+/*                                                                       */
+/*  Purpose: Finds the class of the next character of the line being     */
+/*           parsed, skipping the blanks but not the end of the line     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader                                       */
+/*                                                                       */
+/*            Output:   The class of the character, NEWLINE at the end   */
+/*                      of file                                          */
+/*                                                                       */
+/*************************************************************************/
+static int NextInLine (struct workloadReader *reader){
+    for (;;){
+        while (reader->position < reader->length && characterClass[(unsigned char)reader->buffer[reader->position]] == BLANK)
+            reader->position++;
+        
+        if (reader->position < reader->length)
+            return characterClass[(unsigned char)reader->buffer[reader->position]];
+        if (FillReader(reader) == 0)
+            return NEWLINE;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: NumberInLine                                               */
+/*                                                                       */
+/*  Purpose: Tells if there is another number in the line being parsed,  */
+/*           skipping the blanks but not the end of the line, a comment  */
+/*           nor a separator, so an optional column can be found         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader                                       */
+/*                                                                       */
+/*            Output:   1 if the next thing in the line is not the end   */
+/*                      of it, a comment, a separator or the end of      */
+/*                      file, 0 otherwise                                */
+/*                                                                       */
+/*************************************************************************/
+int NumberInLine (struct workloadReader *reader){
+    int next;                           /* Class of the next character */
+    
+    if (reader->error)
+        return 0;
+    
+    next = NextInLine(reader);
+    return (next != NEWLINE && next != COMMENT && next != SEPARATOR);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: SeparatorInLine                                            */
+/*                                                                       */
+/*  Purpose: Tells if the next thing in the line being parsed is the     */
+/*           separator |, skipping it if it is                           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader                                       */
+/*                                                                       */
+/*            Output:   1 if the separator was found, 0 otherwise        */
+/*                                                                       */
+/*************************************************************************/
+int SeparatorInLine (struct workloadReader *reader){
+    if (reader->error || NextInLine(reader) != SEPARATOR)
+        return 0;
+    
+    reader->position++;
+    return 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CountProcesses                                             */
+/*                                                                       */
+/*  Purpose: Pre-scans the input file and counts the lines that are not  */
+/*           empty nor comments. The first of those lines is the         */
+/*           quantum, every other one describes a process. The lines are */
+/*           found with memchr over big blocks, and the file is rewound  */
+/*           when the count is done                                      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   Pointer to the text file to scan                 */
+/*                                                                       */
+/*            Output:   The number of processes described in the file.   */
+/*                      If they do not fit in an int the program exits   */
+/*                                                                       */
+/*************************************************************************/
+
+int CountProcesses (FILE *fp){
+    char   buffer[SCANBLOCK];                 /* Block read from the file */
+    size_t length;                       /* Characters read in the block */
+    long long lines = 0;              /* Lines that may carry numbers */
+    int    lineStart = 1;  /* Is the next character the start of a line? */
+    
+    while ((length = fread(buffer, 1, sizeof(buffer), fp)) > 0){
+        char *text = buffer, *end = buffer + length;
         
-        return (i * sign);
+        while (text < end){
+            char *newLine;
+            
+            /* Only the first character tells if the line is a comment */
+            if (lineStart)
+                lines += (*text != '#' && *text != '\n');
+            
+            newLine = memchr(text, '\n', (size_t)(end - text));
+            lineStart = (newLine != NULL);
+            text = newLine ? newLine + 1 : end;
+        }
+    }
+    
+    rewind(fp);
+    
+    /* The first line with numbers is the quantum */
+    if (lines - 1 > INT_MAX){
+        ErrorMsg("'CountProcesses'", "The file has more processes than can be simulated");
+        exit(EXIT_FAILURE);
+    }
+    return (lines > 0 ? (int)(lines - 1) : 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CheckWorkloadColumns                                       */
+/*                                                                       */
+/*  Purpose: Checks the values of a mapped binary workload with the same */
+/*           rules as the text workloads: the arrival times can not be   */
+/*           negative and the CPU bursts must be positive                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The map                                          */
+/*                                                                       */
+/*            Output:   1 if every process is right, or -1 after         */
+/*                      reporting the first one that is wrong            */
+/*                                                                       */
+/*************************************************************************/
+static int CheckWorkloadColumns (const struct workloadMap *map){
+    const char *error = NULL;                  /* What is wrong, if any */
+    long long i;                                       /* The process */
+    char message[96];               /* Error message with the process */
+    
+    for (i = 0; i < map->count && !error; i++) {
+        if (map->arrivalTime[i] < 0)
+            error = "the arrival time can not be negative";
+        else if (map->cpuBurst[i] < 1)
+            error = "the CPU burst must be positive";
+    }
+    if (!error)
+        return 1;
+    
+    snprintf(message, sizeof(message), "Process %d of the workload: %s", map->pID[i - 1], error);
+    ErrorMsg("'MapWorkload'", message);
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: MapWorkload                                                */
+/*                                                                       */
+/*  Purpose: Maps a binary workload in memory. Nothing is parsed: the    */
+/*           columns point directly into the mapped file, and the values */
+/*           are checked in one pass. The caller copies them once into   */
+/*           it's workload, before the file is unmapped                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file and where to store the map  */
+/*                                                                       */
+/*            Output:   1 if the file was mapped, 0 if it is not a       */
+/*                      binary workload (it may be a text file) or -1   */
+/*                      if it is a binary workload that can not be used  */
+/*                                                                       */
+/*************************************************************************/
+int MapWorkload (const char *fileName, struct workloadMap *map){
+    struct workloadHeader header;                 /* Header of the file */
+    struct stat status;                         /* The size of the file */
+    int fd;                                         /* The open file */
+    size_t columns;                          /* Columns of the workload */
+    
+    memset(map, 0, sizeof(*map));
+    
+    fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+        return 0;
+    
+    /* A file that does not start with the magic number is not binary */
+    if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(header) ||
+        read(fd, &header, sizeof(header)) != (ssize_t)sizeof(header) ||
+        (header.magic != WORKLOADMAGIC && header.magic != __builtin_bswap32(WORKLOADMAGIC))){
+        close(fd);
+        return 0;
+    }
+    
+    if (header.magic != WORKLOADMAGIC){
+        close(fd);
+        ErrorMsg("'MapWorkload'", "The workload was written with a different byte order");
+        return (-1);
+    }
+    columns = (header.flags & WORKLOADDEADLINES) ? 5 : 4;
+    if (header.version != WORKLOADVERSION || header.count < 0 ||
+        (unsigned long long)header.count > ((unsigned long long)status.st_size - sizeof(header)) / (columns * sizeof(int))){
+        close(fd);
+        ErrorMsg("'MapWorkload'", "The workload is truncated or of an unknown version");
+        return (-1);
+    }
+    if (header.count > INT_MAX){
+        close(fd);
+        ErrorMsg("'MapWorkload'", "The workload has more processes than can be simulated");
+        return (-1);
+    }
+    if (header.quantum < 1){
+        close(fd);
+        ErrorMsg("'MapWorkload'", "The quantum of the workload must be positive");
+        return (-1);
+    }
+    
+    map->size = (size_t)status.st_size;
+    map->address = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map->address == MAP_FAILED){
+        map->address = NULL;
+        ErrorMsg("'MapWorkload'", "The workload can not be mapped in memory");
+        return (-1);
+    }
+    
+    /* The columns are read once, from the beginning to the end */
+    madvise(map->address, map->size, MADV_SEQUENTIAL);
+    
+    map->quantum = header.quantum;
+    map->sorted = (header.flags & WORKLOADSORTED) != 0;
+    map->count = header.count;
+    map->pID = (const int *)((const char *)map->address + sizeof(header));
+    map->arrivalTime = map->pID + header.count;
+    map->cpuBurst = map->arrivalTime + header.count;
+    map->priority = map->cpuBurst + header.count;
+    if (header.flags & WORKLOADDEADLINES)
+        map->deadline = map->priority + header.count;
+    
+    if (CheckWorkloadColumns(map) != 1){
+        UnmapWorkload(map);
+        return (-1);
     }
+    
+    return 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: UnmapWorkload                                              */
+/*                                                                       */
+/*  Purpose: Releases a binary workload mapped in memory                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The map                                          */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void UnmapWorkload (struct workloadMap *map){
+    if (map->address)
+        munmap(map->address, map->size);
+    memset(map, 0, sizeof(*map));
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CreateWorkload                                             */
+/*                                                                       */
+/*  Purpose: Creates a binary workload and writes it's header. The four  */
+/*           columns, and the deadlines if the flags have them, must     */
+/*           follow in order with WriteWorkloadColumn                    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file, the quantum, the flags     */
+/*                      (WORKLOADSORTED and WORKLOADDEADLINES) and how   */
+/*                      many processes there are                         */
+/*                                                                       */
+/*            Output:   The open file, or NULL if it can not be written  */
+/*                                                                       */
+/*************************************************************************/
+FILE *CreateWorkload (const char *fileName, int quantum, unsigned int flags, long long count){
+    struct workloadHeader header;                 /* Header of the file */
+    FILE *fp = fopen(fileName, "wb");                  /* The new file */
+    
+    if (!fp)
+        return NULL;
+    
+    memset(&header, 0, sizeof(header));
+    header.magic = WORKLOADMAGIC;
+    header.version = WORKLOADVERSION;
+    header.quantum = quantum;
+    header.flags = flags;
+    header.count = count;
+    
+    if (fwrite(&header, sizeof(header), 1, fp) != 1){
+        fclose(fp);
+        return NULL;
+    }
+    
+    return fp;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteWorkloadColumn                                        */
+/*                                                                       */
+/*  Purpose: Writes one of the columns of a binary workload              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The file, the values and how many they are       */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+int WriteWorkloadColumn (FILE *fp, const int *values, long long count){
+    if (fwrite(values, sizeof(int), (size_t)count, fp) != (size_t)count)
+        return (EXIT_FAILURE);
+    
+    return (EXIT_SUCCESS);
 }
 
 /************************************************************************/
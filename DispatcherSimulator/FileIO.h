@@ -11,23 +11,32 @@
 /*          Mario García Navarro                                        */
 /*                                                                      */
 /* Purpose:                                                             */
-/*          Support routines that handle reading ASCII files            */
+/*          Support routines that handle reading ASCII files, and the   */
+/*          binary columnar files converted from them                   */
 /*                                                                      */
 /* References:                                                          */
 /*          Based on my own code, but won't be surprised if it is       */
 /*          similar to other code out there                             */
 /*                                                                      */
 /* Restrictions:                                                        */
-/*          All functions return EXIT_FAILURE in case something went    */
-/*          wrong                                                       */
+/*          The numbers must fit in an int                              */
 /*                                                                      */
 /* Revision history:                                                    */
 /*          Feb  4 15:15 2011 -- File created                           */
 /*                                                                      */
 /*          May 22 09:13 2012 -- Added recognition of negative numbers  */
 /*                                                                      */
+/*          Oct 17 13:30 2026 -- GetInt replaced by a block reader      */
+/*                                                                      */
+/*          Oct 17 16:20 2026 -- Added the binary workload format       */
+/*                                                                      */
+/*          Oct 17 23:55 2026 -- Added the column of deadlines          */
+/*                                                                      */
+/*          Oct 17 23:59 2026 -- Added the separator of the I/O cycles  */
+/*                                                                      */
 /* Error handling:                                                      */
-/*          None                                                        */
+/*          ReadInt returns -1 and keeps the message, line and column   */
+/*          of the error in the reader                                  */
 /*                                                                      */
 /* Notes:                                                               */
 /*          Support routine that reads an ASCII file and returns an     */
@@ -39,6 +48,58 @@
 /*                  Declare the function prototypes                     */
 /************************************************************************/
 
-int  GetInt (FILE *fp);
+struct workloadReader{
+    FILE *fp;                                   /* The file being parsed */
+    char *buffer;                       /* Block of the file in memory */
+    size_t length;                        /* Characters in the buffer */
+    size_t position;                  /* Next character to be parsed */
+    long long offset;          /* Characters of the file before the buffer */
+    long long lineStart;       /* Character of the file where the line starts */
+    int line;                                /* Line being parsed */
+    int endOfFile;                  /* Has the whole file been read? */
+    const char *error;           /* Message of the error, if there is one */
+    int errorLine;                         /* Line of the error */
+    int errorColumn;                      /* Column of the error */
+};
+
+/* The binary workload starts with this header, followed by four columns
+ of count ints each: process ID, arrival time, CPU burst and priority, and
+ a fifth one with the deadlines if the flag says so */
+#define WORKLOADMAGIC   0x4C575344         /* "DSWL" in a little endian file */
+#define WORKLOADVERSION 1
+#define WORKLOADSORTED  1        /* Flag: the processes are in arrival order */
+#define WORKLOADDEADLINES 2       /* Flag: the column of deadlines follows */
+
+struct workloadHeader{
+    unsigned int magic;                             /* WORKLOADMAGIC */
+    unsigned int version;                         /* WORKLOADVERSION */
+    int quantum;                        /* Quantum for Round Robin */
+    unsigned int flags;                            /* WORKLOADSORTED */
+    long long count;                           /* Number of processes */
+};
+
+struct workloadMap{
+    void *address;                     /* Where the file is mapped */
+    size_t size;                               /* Size of the file */
+    int quantum;                        /* Quantum for Round Robin */
+    int sorted;            /* Are the processes in arrival order? */
+    long long count;                           /* Number of processes */
+    const int *pID;                              /* The four columns */
+    const int *arrivalTime;
+    const int *cpuBurst;
+    const int *priority;
+    const int *deadline;        /* The deadlines, or NULL if there are none */
+};
+
+int  OpenReader (struct workloadReader *reader, FILE *fp);
+void CloseReader (struct workloadReader *reader);
+int  ReadInt (struct workloadReader *reader, int *value);
+int  NumberInLine (struct workloadReader *reader);
+int  SeparatorInLine (struct workloadReader *reader);
+int  CountProcesses (FILE *fp);
+int  MapWorkload (const char *fileName, struct workloadMap *map);
+void UnmapWorkload (struct workloadMap *map);
+FILE *CreateWorkload (const char *fileName, int quantum, unsigned int flags, long long count);
+int  WriteWorkloadColumn (FILE *fp, const int *values, long long count);
 void ErrorMsg (char * function, char *message);
 
@@ -0,0 +1,378 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Generator.c                                                */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Generator of synthetic workloads, used to measure how the    */
+/*          simulator behaves with any number of processes               */
+/*                                                                       */
+/* References:                                                           */
+/*          xoshiro256** and splitmix64 generators by Blackman and Vigna */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          The arrival times and the CPU bursts are cut at the biggest  */
+/*          int, so the processes always fit in the process list         */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 19:30 2026 - File created                            */
+/*                                                                       */
+/*          Oct  17 23:55 2026 - Deadlines with a slack over the burst   */
+/*                                                                       */
+/*          Oct  17 23:56 2026 - Cycles of I/O and CPU bursts            */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The cycles are written after a |        */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          A wrong option is reported and not applied                   */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The processes arrive as a Poisson process, or in bursts of   */
+/*          processes that arrive close together, separated by long     */
+/*          gaps, with the same mean rate. The CPU bursts follow an      */
+/*          exponential distribution, or a Pareto distribution with a    */
+/*          heavy tail of very long processes. The priorities are        */
+/*          uniform, or skewed so every level is half as likely as the   */
+/*          one before it. With cycles, every process gets from none to  */
+/*          twice that many pairs of an exponential I/O burst and a CPU  */
+/*          burst                                                        */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                        /* Used for the function printf */
+#include <stdlib.h>                        /* Used for the function strtod */
+#include <string.h>                       /* Used for the function strncmp */
+#include <limits.h>                        /* Used for the INT_MAX value */
+#include <math.h>                           /* Used for the function log */
+#include "FileIO.h"                     /* Used for the ErrorMsg function */
+#include "Queue.h"               /* Needed by the process definitions */
+#include "Report.h"              /* Needed by the process definitions */
+#include "Process.h"                  /* Used for the process structure */
+#include "Generator.h"                                 /* Function header */
+
+#define MAXCYCLES 1000          /* The most I/O cycles per process, on average */
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: InitGenerator                                              */
+/*                                                                       */
+/*  Purpose: Fills a generator with the default options: a thousand      */
+/*           processes with Poisson arrivals, exponential bursts of ten  */
+/*           units of time on average, and ten uniform priorities        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator                                    */
+/*                                                                       */
+/*            Output:   The generator with the default options           */
+/*                                                                       */
+/*************************************************************************/
+void InitGenerator(struct generator *generator){
+    *generator = (struct generator){
+        .count = 1000, .quantum = 4,
+        .arrivals = POISSON, .rate = 0.1, .burstSize = 8.0,
+        .bursts = EXPONENTIAL, .meanBurst = 10.0, .shape = 1.5,
+        .priorities = UNIFORM, .levels = 10,
+        .meanIO = 10.0, .seed = 1
+    };
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: SetGeneratorOption                                         */
+/*                                                                       */
+/*  Purpose: Changes one option of a generator, given as "name=value".   */
+/*           The options are count, quantum, arrivals (poisson or        */
+/*           bursty), rate, burstsize, bursts (exponential or pareto),   */
+/*           mean, shape, priorities (uniform or skewed), levels, slack, */
+/*           cycles, io and seed                                         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator and the option                     */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE if the option is   */
+/*                      unknown or it's value is wrong                   */
+/*                                                                       */
+/*************************************************************************/
+int SetGeneratorOption(struct generator *generator, const char *option){
+    const char *value = strchr(option, '=');     /* Value of the option */
+    size_t length;                               /* Length of the name */
+    char *end;                           /* End of the number read */
+    double number;                           /* Value, if it is a number */
+    
+    if (!value) {
+        ErrorMsg("'SetGeneratorOption'", "The options must be given as name=value");
+        return (EXIT_FAILURE);
+    }
+    length = (size_t)(value - option);
+    value++;
+    
+#define OPTION(name) (length == sizeof(name) - 1 && strncmp(option, name, length) == 0)
+    
+    /* The distributions are named */
+    if (OPTION("arrivals") || OPTION("bursts") || OPTION("priorities")) {
+        int *field = OPTION("arrivals") ? &generator->arrivals :
+                     OPTION("bursts") ? &generator->bursts : &generator->priorities;
+        
+        if (strcmp(value, "poisson") == 0 || strcmp(value, "exponential") == 0 || strcmp(value, "uniform") == 0)
+            *field = 0;
+        else if (strcmp(value, "bursty") == 0 || strcmp(value, "pareto") == 0 || strcmp(value, "skewed") == 0)
+            *field = 1;
+        else {
+            ErrorMsg("'SetGeneratorOption'", "Unknown distribution, use poisson, bursty, exponential, pareto, uniform or skewed");
+            return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+    }
+    
+    /* The rest of the options are positive numbers */
+    number = strtod(value, &end);
+    if (end == value || *end != '\0' || !(number > 0)) {
+        ErrorMsg("'SetGeneratorOption'", "The value of the option must be a positive number");
+        return (EXIT_FAILURE);
+    }
+    
+    if (OPTION("count") && number <= INT_MAX)
+        generator->count = (long long)number;
+    else if (OPTION("quantum") && number <= INT_MAX)
+        generator->quantum = (int)number;
+    else if (OPTION("rate"))
+        generator->rate = number;
+    else if (OPTION("burstsize") && number >= 1)
+        generator->burstSize = number;
+    else if (OPTION("mean") && number >= 1)
+        generator->meanBurst = number;
+    else if (OPTION("shape") && number > 1)
+        generator->shape = number;
+    else if (OPTION("levels") && number <= INT_MAX)
+        generator->levels = (int)number;
+    else if (OPTION("slack"))
+        generator->slack = number;
+    else if (OPTION("cycles") && number <= MAXCYCLES)
+        generator->cycles = (int)number;
+    else if (OPTION("io") && number >= 1)
+        generator->meanIO = number;
+    else if (OPTION("seed"))
+        generator->seed = (unsigned long long)number;
+    else {
+        ErrorMsg("'SetGeneratorOption'", "Unknown option, or it's value is out of range");
+        return (EXIT_FAILURE);
+    }
+    
+#undef OPTION
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StartGenerator                                             */
+/*                                                                       */
+/*  Purpose: Prepares a generator to give it's processes from the first  */
+/*           one. The state of the random numbers is filled from the     */
+/*           seed with splitmix64                                        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator                                    */
+/*                                                                       */
+/*            Output:   The generator, ready for the first process       */
+/*                                                                       */
+/*************************************************************************/
+void StartGenerator(struct generator *generator){
+    unsigned long long x = generator->seed;          /* splitmix64 state */
+    
+    for (int i = 0; i < 4; i++) {
+        unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        generator->state[i] = z ^ (z >> 31);
+    }
+    
+    generator->time = 0.0;
+    generator->created = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Uniform                                                    */
+/*                                                                       */
+/*  Purpose: Obtains the next random number of a generator, with         */
+/*           xoshiro256**, as a double in the interval (0, 1)            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator                                    */
+/*                                                                       */
+/*            Output:   The random number                                */
+/*                                                                       */
+/*************************************************************************/
+static double Uniform(struct generator *generator){
+    unsigned long long *s = generator->state;   /* State of the numbers */
+    unsigned long long result = s[1] * 5, t = s[1] << 17;
+    
+    result = ((result << 7) | (result >> 57)) * 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    
+    /* The 53 highest bits, moved half a step so neither 0 nor 1 can appear */
+    return ((double)(result >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Exponential                                                */
+/*                                                                       */
+/*  Purpose: Obtains a random number with an exponential distribution    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator and the mean                       */
+/*                                                                       */
+/*            Output:   The random number                                */
+/*                                                                       */
+/*************************************************************************/
+static double Exponential(struct generator *generator, double mean){
+    return -mean * log(Uniform(generator));
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Clamp                                                      */
+/*                                                                       */
+/*  Purpose: Converts a time to an int, cutting it at the biggest int    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The time                                         */
+/*                                                                       */
+/*            Output:   The time as an int                               */
+/*                                                                       */
+/*************************************************************************/
+static int Clamp(double time){
+    return (time >= (double)INT_MAX ? INT_MAX : (int)time);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CpuBurst                                                   */
+/*                                                                       */
+/*  Purpose: Obtains the length of a CPU burst. The Pareto distribution  */
+/*           has the same mean as the exponential one, but a heavy tail  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator                                    */
+/*                                                                       */
+/*            Output:   The length, never shorter than one unit          */
+/*                                                                       */
+/*************************************************************************/
+static int CpuBurst(struct generator *generator){
+    double burst;                                 /* Length of the burst */
+    
+    if (generator->bursts == PARETO)
+        burst = generator->meanBurst * (generator->shape - 1.0) / generator->shape *
+                pow(Uniform(generator), -1.0 / generator->shape);
+    else
+        burst = Exponential(generator, generator->meanBurst);
+    
+    return Clamp(burst + 1.0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: NextProcess                                                */
+/*                                                                       */
+/*  Purpose: Generates the next process, which never arrives before the  */
+/*           ones generated before it. With a slack, it's deadline is    */
+/*           that many times it's CPU burst after it's arrival           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator and where to store the process     */
+/*                                                                       */
+/*            Output:   The process                                      */
+/*                                                                       */
+/*************************************************************************/
+void NextProcess(struct generator *generator, struct process *process){
+    int burst;                                    /* Length of the burst */
+    int priority = 0;                          /* Priority of the process */
+    
+    /* The time between arrivals. In a bursty pattern a new burst starts with a probability that gives the mean burst size, and
+     the gaps between bursts are long enough to keep the mean rate */
+    if (generator->arrivals == BURSTY) {
+        double size = generator->burstSize;          /* Processes per burst */
+        
+        if (Uniform(generator) * size < 1.0)
+            generator->time += Exponential(generator, size / generator->rate - (size - 1.0) / (generator->rate * size));
+        else
+            generator->time += Exponential(generator, 1.0 / (generator->rate * size));
+    }
+    else
+        generator->time += Exponential(generator, 1.0 / generator->rate);
+    
+    burst = CpuBurst(generator);
+    
+    /* With skewed priorities, every level is half as likely as the one before it, and the rest go to the last level */
+    if (generator->priorities == SKEWED)
+        while (priority < generator->levels - 1 && Uniform(generator) < 0.5)
+            priority++;
+    else
+        priority = (int)(Uniform(generator) * generator->levels);
+    
+    process->pID = (int)++generator->created;
+    process->arrivalTime = Clamp(generator->time);
+    process->cpuBurst = burst;
+    process->priority = priority;
+    process->deadline = generator->slack > 0 ? Clamp(process->arrivalTime + generator->slack * process->cpuBurst) : NODEADLINE;
+    process->ioTime = process->firstExecuted = process->lastExecuted = 0;
+    process->cycle = -1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteGeneratedWorkload                                     */
+/*                                                                       */
+/*  Purpose: Writes all the processes of a generator as a text file: the */
+/*           quantum and then one process per line, with it's deadline   */
+/*           if there is a slack and it's I/O cycles if there are cycles */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The generator and the file                       */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE if the file can    */
+/*                      not be written                                   */
+/*                                                                       */
+/*************************************************************************/
+int WriteGeneratedWorkload(struct generator *generator, FILE *fp){
+    struct process process;                      /* The next process */
+    
+    StartGenerator(generator);
+    fprintf(fp, "%d\n", generator->quantum);
+    for (long long i = 0; i < generator->count; i++) {
+        NextProcess(generator, &process);
+        fprintf(fp, "%d %d %d %d", process.pID, process.arrivalTime, process.cpuBurst, process.priority);
+        if (generator->slack > 0)
+            fprintf(fp, " %d", process.deadline);
+        
+        /* The number of cycles is uniform, and the CPU bursts after the first one follow the same distribution */
+        if (generator->cycles > 0) {
+            long long total = process.cpuBurst;       /* All the CPU bursts */
+            int cycles = (int)(Uniform(generator) * (2 * generator->cycles + 1));
+            
+            for (int c = 0; c < cycles; c++) {
+                int io = Clamp(Exponential(generator, generator->meanIO) + 1.0); /* The I/O burst */
+                int cpu = CpuBurst(generator);                    /* The next CPU burst */
+                
+                if (total + cpu > INT_MAX)
+                    break;
+                total += cpu;
+                fprintf(fp, c == 0 ? " | %d %d" : " %d %d", io, cpu);
+            }
+        }
+        fputc('\n', fp);
+    }
+    
+    return (ferror(fp) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
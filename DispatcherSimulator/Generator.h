@@ -0,0 +1,68 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Generator.h                                                */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Generator of synthetic workloads, used to measure how the    */
+/*          simulator behaves with any number of processes               */
+/*                                                                       */
+/* References:                                                           */
+/*          xoshiro256** and splitmix64 generators by Blackman and Vigna */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          Must be included after Process.h                             */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 19:30 2026 -- File created                           */
+/*                                                                       */
+/*          Oct  17 23:56 2026 -- I/O cycles                             */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          A wrong option is reported and not applied                   */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The same options and seed always give the same processes, on */
+/*          any machine                                                  */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+enum arrivalPatterns {POISSON = 0, BURSTY};
+enum burstLengths {EXPONENTIAL = 0, PARETO};
+enum priorityPatterns {UNIFORM = 0, SKEWED};
+
+struct generator{
+    long long count;                    /* Processes to be generated */
+    int quantum;                       /* Quantum value for Round Robin */
+    int arrivals;                     /* Poisson or bursty arrivals */
+    double rate;                    /* Mean processes per unit of time */
+    double burstSize;    /* Mean processes per burst of bursty arrivals */
+    int bursts;                   /* Exponential or Pareto CPU bursts */
+    double meanBurst;                       /* Mean CPU burst length */
+    double shape;                /* Shape of the Pareto distribution */
+    int priorities;               /* Uniform or skewed priorities */
+    int levels;                          /* Number of priority levels */
+    double slack;    /* Time from the arrival to the deadline, in CPU
+                                           bursts, or 0 for none */
+    int cycles;   /* Mean I/O cycles per process, or 0 for none */
+    double meanIO;                           /* Mean I/O burst length */
+    unsigned long long seed;             /* Seed of the random numbers */
+    unsigned long long state[4];     /* State of the random numbers */
+    double time;                      /* Arrival of the last process */
+    long long created;                /* Processes generated so far */
+};
+
+void InitGenerator(struct generator *generator);
+int SetGeneratorOption(struct generator *generator, const char *option);
+void StartGenerator(struct generator *generator);
+void NextProcess(struct generator *generator, struct process *process);
+int WriteGeneratedWorkload(struct generator *generator, FILE *fp);
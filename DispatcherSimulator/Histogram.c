@@ -0,0 +1,178 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Histogram.c                                                */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Histograms of the times of the processes, used to obtain     */
+/*          their percentiles without keeping every time                 */
+/*                                                                       */
+/* References:                                                           */
+/*          HdrHistogram by Gil Tene                                     */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          A histogram must be used by one thread at a time             */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 23:58 2026 - File created                            */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          None                                                         */
+/*                                                                       */
+/* Notes:                                                                */
+/*          A histogram takes about 30 KB, whatever the number of times  */
+/*          recorded. Recording a time costs a count of leading zeros    */
+/*          and a shift, and a percentile is found walking the buckets   */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                       /* Needed by the report definitions */
+#include <string.h>                       /* Used for the function memset */
+#include "Report.h"             /* Used for the distributions of the times */
+#include "Histogram.h"                                 /* Function header */
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ClearHistogram                                             */
+/*                                                                       */
+/*  Purpose: Empties a histogram                                         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The histogram                                    */
+/*                                                                       */
+/*            Output:   The histogram without times                      */
+/*                                                                       */
+/*************************************************************************/
+void ClearHistogram(struct histogram *histogram){
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: BucketOf                                                   */
+/*                                                                       */
+/*  Purpose: Finds the bucket of a time. The highest bit of the time     */
+/*           gives it's power of two, and the next bits it's bucket      */
+/*           inside of it                                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The time, not negative                           */
+/*                                                                       */
+/*            Output:   The bucket                                       */
+/*                                                                       */
+/*************************************************************************/
+static int BucketOf(long long time){
+    int shift;                    /* Bits of the time below it's bucket */
+    
+    if (time < 2 * SUBBUCKETS)
+        return (int)time;
+    
+    shift = 63 - __builtin_clzll((unsigned long long)time) - SUBBUCKETBITS;
+    return (shift + 1) * SUBBUCKETS + (int)(time >> shift) - SUBBUCKETS;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: HighestOf                                                  */
+/*                                                                       */
+/*  Purpose: Obtains the longest time that falls in a bucket             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The bucket                                       */
+/*                                                                       */
+/*            Output:   The time                                         */
+/*                                                                       */
+/*************************************************************************/
+static long long HighestOf(int bucket){
+    int shift = bucket / SUBBUCKETS - 1;  /* Bits of the times below it */
+    
+    if (bucket < 2 * SUBBUCKETS)
+        return bucket;
+    
+    return ((long long)(bucket % SUBBUCKETS + SUBBUCKETS + 1) << shift) - 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RecordTime                                                 */
+/*                                                                       */
+/*  Purpose: Adds a time to a histogram. A negative time counts as 0     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The histogram and the time                       */
+/*                                                                       */
+/*            Output:   The histogram with the time                      */
+/*                                                                       */
+/*************************************************************************/
+void RecordTime(struct histogram *histogram, long long time){
+    if (time < 0)
+        time = 0;
+    
+    histogram->counts[BucketOf(time)]++;
+    histogram->count++;
+    histogram->sum += time;
+    if (time > histogram->max)
+        histogram->max = time;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: TimeAtPercentile                                           */
+/*                                                                       */
+/*  Purpose: Obtains the time below which a percentage of the times of a */
+/*           histogram fall. It is the longest time of the bucket where  */
+/*           that percentage is reached, but never more than the         */
+/*           longest time recorded                                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The histogram and the percentile, from 0 to 100  */
+/*                                                                       */
+/*            Output:   The time, or 0 if the histogram is empty         */
+/*                                                                       */
+/*************************************************************************/
+long long TimeAtPercentile(const struct histogram *histogram, double percentile){
+    double share = percentile / 100.0 * (double)histogram->count; /* Times that must be reached */
+    long long rank = (long long)share;             /* The same, rounded up */
+    long long seen = 0;                       /* Times in the buckets so far */
+    
+    if (histogram->count == 0)
+        return 0;
+    if (rank < share - 1e-9)
+        rank++;
+    if (rank < 1)
+        rank = 1;
+    
+    for (int bucket = 0; bucket < HISTOGRAMBUCKETS; bucket++) {
+        seen += histogram->counts[bucket];
+        if (seen >= rank)
+            return (HighestOf(bucket) < histogram->max ? HighestOf(bucket) : histogram->max);
+    }
+    
+    return histogram->max;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: SummarizeHistogram                                         */
+/*                                                                       */
+/*  Purpose: Obtains the mean, the percentiles 50, 90, 99 and 99.9 and   */
+/*           the maximum of the times of a histogram                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The histogram and where to store the summary     */
+/*                                                                       */
+/*            Output:   The distribution of the times                    */
+/*                                                                       */
+/*************************************************************************/
+void SummarizeHistogram(const struct histogram *histogram, struct distribution *distribution){
+    distribution->mean = histogram->count > 0 ? (double)histogram->sum / (double)histogram->count : 0.0;
+    distribution->p50 = TimeAtPercentile(histogram, 50.0);
+    distribution->p90 = TimeAtPercentile(histogram, 90.0);
+    distribution->p99 = TimeAtPercentile(histogram, 99.0);
+    distribution->p999 = TimeAtPercentile(histogram, 99.9);
+    distribution->max = histogram->max;
+}
@@ -0,0 +1,53 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Histogram.h                                                */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Histograms of the times of the processes, used to obtain     */
+/*          their percentiles without keeping every time                 */
+/*                                                                       */
+/* References:                                                           */
+/*          HdrHistogram by Gil Tene                                     */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          Must be included after Report.h                              */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 23:58 2026 -- File created                           */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          None                                                         */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The times below 128 have a bucket each. Above them, every    */
+/*          power of two is split in 64 buckets, so a percentile is      */
+/*          never more than 1.6% above the real one, and any time that   */
+/*          fits in a long long has a bucket                             */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+#define SUBBUCKETBITS 6              /* Buckets per power of two, as bits */
+#define SUBBUCKETS (1 << SUBBUCKETBITS)
+#define HISTOGRAMBUCKETS ((64 - SUBBUCKETBITS) * SUBBUCKETS) /* Any time */
+
+struct histogram{
+    long long counts[HISTOGRAMBUCKETS];     /* Times found per bucket */
+    long long count;                          /* Times recorded */
+    long long sum;                        /* Exact sum of the times */
+    long long max;                          /* The longest time */
+};
+
+void ClearHistogram(struct histogram *histogram);
+void RecordTime(struct histogram *histogram, long long time);
+long long TimeAtPercentile(const struct histogram *histogram, double percentile);
+void SummarizeHistogram(const struct histogram *histogram, struct distribution *distribution);
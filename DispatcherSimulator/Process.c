@@ -8,19 +8,18 @@
 /*          Mario García Navarro                                         */
 /*                                                                       */
 /* Purpose:                                                              */
-/*          Implement routines that simulate a dispatcher in 6           */
-/*          different algorithms                                         */
+/*          Implement routines that simulate a dispatcher in 9           */
+/*          different algorithms, over one CPU or many                   */
 /*                                                                       */
 /* References:                                                           */
 /*          Abelardo López Lagunas code shown during lab class           */
 /*                                                                       */
 /* Restrictions:                                                         */
-/*          The code is implemented using static structures, due to this */
-/*          this fact, the number of processes is limited to 10. If by   */
-/*          any means this rule is not considered, the code simply will  */
-/*          not work as expected.                                        */
-/*          There is no management if exists 'gaps' or 'spaces' between  */
-/*          processes in the main process list                           */
+/*          The process list grows as processes are created, so the      */
+/*          number of processes is only limited by the memory available. */
+/*          The processes given by a source must be ordered by arrival.  */
+/*          A simulation context must be used by one thread at a time,   */
+/*          but a workload can be shared by many contexts once built     */
 /*                                                                       */
 /* Revision history:                                                     */
 /*          Sep  17 01:21 2014 - File created                            */
@@ -33,984 +32,2587 @@
 /*                                                                       */
 /*          Sep  22 01:12 2014 - Code Refactoring                        */
 /*                                                                       */
+/*          Oct  17 09:10 2026 - The process lists are allocated         */
+/*                               dynamically and grow on demand          */
+/*                                                                       */
+/*          Oct  17 10:02 2026 - Event driven Preemptive algorithms      */
+/*                                                                       */
+/*          Oct  17 10:40 2026 - Ready queue for the Non Preemptive      */
+/*                               algorithms                              */
+/*                                                                       */
+/*          Oct  17 11:25 2026 - Radix sort over packed keys replaces    */
+/*                               the Bubble Sort                         */
+/*                                                                       */
+/*          Oct  17 12:05 2026 - Circular run queue for Round Robin      */
+/*                                                                       */
+/*          Oct  17 15:10 2026 - The algorithms take the processes from  */
+/*                               a source, so they can be streamed       */
+/*                                                                       */
+/*          Oct  17 17:05 2026 - No global state. The algorithms run in  */
+/*                               a simulation context over a workload    */
+/*                               that is only read                       */
+/*                                                                       */
+/*          Oct  17 18:40 2026 - The results are kept in the simulation, */
+/*                               which can run without printing          */
+/*                                                                       */
+/*          Oct  17 20:15 2026 - The results are written through the     */
+/*                               buffered reports                        */
+/*                                                                       */
+/*          Oct  17 21:00 2026 - The slices of the CPU can be traced     */
+/*                                                                       */
+/*          Oct  17 22:10 2026 - The algorithms can run over many CPUs,  */
+/*                               with a global queue or one queue per    */
+/*                               CPU and work stealing                   */
+/*                                                                       */
+/*          Oct  17 23:00 2026 - Added the Multilevel Feedback Queue     */
+/*                                                                       */
+/*          Oct  17 23:40 2026 - Added the Completely Fair Scheduler     */
+/*                                                                       */
+/*          Oct  17 23:55 2026 - Added the deadlines, the misses of every */
+/*                               algorithm and Earliest Deadline First   */
+/*                                                                       */
+/*          Oct  17 23:56 2026 - The processes can alternate CPU and I/O */
+/*                               bursts, served by the FIFO queues of    */
+/*                               the devices                             */
+/*                                                                       */
+/*          Oct  17 23:57 2026 - The context switches and the migrations */
+/*                               can cost time of the CPU                */
+/*                                                                       */
+/*          Oct  17 23:58 2026 - The waiting, response and turnaround    */
+/*                               times are kept in histograms            */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The events and the work of the ready    */
+/*                               queues are counted for the stats        */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - One engine for the algorithms of one    */
+/*                               CPU, instantiated with the selection    */
+/*                               policy of every algorithm, and the sort */
+/*                               scans the fields as columns             */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The workloads keep every field of the   */
+/*                               processes in it's own column            */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - Removed Sort, which nothing used since  */
+/*                               the radix sort replaced it              */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The engine for many CPUs is inlined     */
+/*                               with a constant queue policy too        */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The process list and the cycles can not */
+/*                               grow past INT_MAX                       */
+/*                                                                       */
 /* Error handling:                                                       */
-/*          None                                                         */
+/*          If the memory for the process lists can not be obtained, the */
+/*          program exits                                                */
 /*                                                                       */
 /* Notes:                                                                */
-/*          Six different algorithms will be implemented with the        */
-/*          purpose of simulate the behaviour of diverse dispatchers.    */
-/*          The average waiting time of the processes will be obtained   */
+/*          Nine different algorithms are implemented with the purpose   */
+/*          of simulate the behaviour of diverse dispatchers: the six    */
+/*          classic ones, the Multilevel Feedback Queue, the Completely  */
+/*          Fair Scheduler and Earliest Deadline First. The waiting,     */
+/*          response and turnaround times of the processes are obtained  */
 /*          in order to conclude which is the best algorithm in these    */
 /*          terms.                                                       */
 /*                                                                       */
 /*************************************************************************/
 
 #include <stdio.h>                        /* Used for the function printf */
+#include <stdlib.h>        /* Used for the memory allocation functions */
+#include <string.h>                       /* Used for the function strcmp */
+#include <limits.h>                       /* Used for the LLONG_MAX value */
+#include "FileIO.h"                     /* Used for the ErrorMsg function */
+#include "Queue.h"              /* Used for the ready queue of processes */
+#include "Report.h"                   /* Used for the reports of results */
+#include "Trace.h"                      /* Used for the traces of the CPU */
+#include "Histogram.h"        /* Used for the percentiles of the times */
 #include "Process.h"                                   /* Function header */
 
-#define NUMBERPROCESSES 10          /* The number of max processes that the
-                                                    structure can handle */
-int numberOfProcess = 0;                /* The number of processes that are
-                                                     defined in the file */
-
-struct process{
-    int pID;                                           /* The process ID */
-    int priority;        /* This is important for the Priority Algorithm */
-    int cpuBurst;                             /* Lenght of the CPU burst */
-    int arrivalTime;                         /* Time of process creation */
-    int waitTime;                        /* Time spent in the wait queue */
-    int firstExecuted;                        /* Time of first execution */
-    int lastExecuted;                          /* Time of last execution */
-};
+#define SORTFIELDS 3      /* The max number of fields used by the sort */
+#define WORKLOADCOLUMNS 6   /* Columns of a workload, with the cycle */
+#define INITIALPROCESSES 16   /* Initial capacity of the process list when
+                                 the number of processes is not known */
+#define FIFO -1   /* The key of the queues of Round Robin, which keep the
+                                               order of arrival */
+#define LEVELS -2   /* The key of the queues of the Multilevel Feedback
+                      Queue, which keep the order of arrival per level */
+#define VRUNTIME -3  /* The key of the queues of the Completely Fair
+                        Scheduler, which keep the order of virtual runtime */
+#define NICE0WEIGHT 1024       /* The weight of a process of priority 0 */
+#define VRUNTIMEUNIT 1024  /* Parts of a unit of virtual runtime, so the
+                              heaviest processes still make progress */
+#define MINNICE -20                /* The priorities used as nice values */
+#define MAXNICE 19
 
-struct process processList[NUMBERPROCESSES];    /* The main process list */
+static const char *policies[NUMPOLICIES] = {"global", "steal"};
 
-struct process contextProcessList[NUMBERPROCESSES * 2]; /* This is defined 
-                                                         because is 
-                                                         required another 
-                                                         process list
-                                                         that contains
-                                                         the information
-                                                         about the context
-                                                         changes. Is
-                                                         used on the 
-                                                         preemptive 
-                                                         algorithms */
+static const int weights[MAXNICE - MINNICE + 1] = {  /* Every priority gets
+                                     about 25% less CPU than the one above */
+    88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906, 3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45, 36, 29, 23, 18, 15};
 
-struct process processListCopy[NUMBERPROCESSES];     /* This is defined in
-                                                     order to keep a clean
-                                                          copy of the main
-                                                           process list */
+struct sortKey{
+    int fields[SORTFIELDS];          /* The fields compared by the sort */
+    int index;                   /* Position of the process in the range */
+};
+
+struct latencies{
+    struct histogram wait;               /* The waiting times of a run */
+    struct histogram response;  /* From the arrival to the first dispatch */
+    struct histogram turnaround;      /* The turnaround times of a run */
+};
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: CreateProcessList                                          */
+/*  Function: ColumnsOf                                                  */
 /*                                                                       */
-/*  Purpose: The function will be in charge to create the main list      */
-/*           of processes                                                */
+/*  Purpose: Lists the columns of a workload, so all of them can be      */
+/*           resized, released or reordered together                     */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process ID, arrival time, CPU burst and      */
-/*                      priority                                         */
+/*            Input :   The workload and where to store the columns      */
 /*                                                                       */
-/*            Output:   The main process list                            */
+/*            Output:   Where every column of the workload is kept       */
 /*                                                                       */
 /*************************************************************************/
-void CreateProcessList(int pID, int arrivalTime, int cpuBurst, int priority){
-    /* All the paramaters obtained from the file are 
-    assigned to the new process */
-    processList[numberOfProcess].pID = pID;
-    processList[numberOfProcess].arrivalTime = arrivalTime;
-    processList[numberOfProcess].cpuBurst = cpuBurst;
-    processList[numberOfProcess].priority = priority;
-    numberOfProcess++; /* This variable is incremented in order to know how 
-                        many processes we will be working with */
+static void ColumnsOf(struct workload *workload, int **columns[WORKLOADCOLUMNS]){
+    columns[0] = &workload->pID;
+    columns[1] = &workload->arrivalTime;
+    columns[2] = &workload->cpuBurst;
+    columns[3] = &workload->priority;
+    columns[4] = &workload->deadline;
+    columns[5] = &workload->cycle;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: SortProcessList                                            */
+/*  Function: ReserveProcessList                                         */
 /*                                                                       */
-/*  Purpose: This function sorts the process list considering different  */
-/*           conditions for the sort. All the processes are sorted       */
-/*           using the 'Bubble Sort' algorithm                           */
+/*  Purpose: Makes sure that the columns of a workload can hold at least */
+/*           the number of processes requested                           */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The sort condition                               */
+/*            Input :   The workload and the number of processes that    */
+/*                      must fit                                         */
 /*                                                                       */
-/*            Output:   The main process list ordered by the condition   */
-/*                      that have been determined earlier                */
+/*            Output:   The columns with the new capacity. If the memory */
+/*                      can not be obtained the program exits            */
 /*                                                                       */
 /*************************************************************************/
-void SortProcessList(int sortBy){
-    switch (sortBy) {
-        
-        /* This case considers only the arrival time for the sort */
-        case ARRIVALTIME:
-            for (int i = 0; i < numberOfProcess; i++){
-                for (int j = i + 1; j < numberOfProcess; j++){
-                    /* Exchange the processes if the arrival time of the first process is higher than the second process */
-                    if (processList[i].arrivalTime > processList[j].arrivalTime){
-                        struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                   in order to not lose it during the exchange */
-                        processList[i] =  processList[j];
-                         processList[j] = temporal;
-                    }
-                }
-            }
-            break;
-            
-        /* This condition is used on the SJF algorithms. Basically is
-        used if there exists processes that arrive at the same time at the very beginning but
-        differs on CPU burst. This orders the process list considering
-        the lowest CPU burst */
-        case CPUBURST:
-            for (int i = 0; i < numberOfProcess; i++){
-                for (int j = i + 1; j < numberOfProcess; j++){
-                    /* If the processes arrival time is the same, compare the CPU burst times of each process. Else, break the cycles
-                     in order to decrease the execution time. Since this function is used only to sort the processes which arrive at the
-                     very beginning, this can be done without compromising the results */
-                    if (processList[i].arrivalTime == processList[j].arrivalTime){
-                        if (processList[i].cpuBurst == processList[j].cpuBurst){
-                            if (processList[i].pID > processList[j].pID){
-                                struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                           in order to not lose it during the exchange */
-                                
-                                processList[i] =  processList[j];
-                                processList[j] = temporal;
-                            }
-                        }
-                        /* Exchange the processes if the CPU burst of the second process is lower than the first one */
-                        else if(processList[i].cpuBurst > processList[j].cpuBurst){
-                            struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                       in order to not lose it during the exchange */
-                            processList[i] =  processList[j];
-                            processList[j] = temporal;
-                        }
-                    }
-                }
-            }
-            break;
-        
-        /* This condition is used on the Priority algorithms. Basically 
-        is used if there exists processes that arrive at the same time but
-        differs on priority. This orders the process list considering
-        the highest priority */
-        case PRIORITY:
-            for (int i = 0; i < numberOfProcess; i++){
-                for (int j = i + 1; j < numberOfProcess; j++){
-                    /* If the processes arrival time is the same, compare the priority of each process. Else, break the cycles
-                     in order to decrease the execution time. Since this function is used only to sort the processes which arrive at the
-                     very beginning, this can be done without compromising the results */
-                    if (processList[i].arrivalTime == processList[j].arrivalTime){
-                        /* If the priority of the processes are the same, keep at top
-                         the process who it's Process ID is less */
-                        if (processList[i].priority == processList[j].priority){
-                            if (processList[i].pID > processList[j].pID){
-                                struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                           in order to not lose it during the exchange */
-                                
-                                processList[i] =  processList[j];
-                                processList[j] = temporal;
-                            }
-                        }
-                        /* Exchange the processes if the CPU burst of the second process is higher than the first one */
-                        else if(processList[i].priority > processList[j].priority){
-                            struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                  in order to not lose it during the exchange */
-                            processList[i] =  processList[j];
-                            processList[j] = temporal;
-                        }
-                    }
-                }
-            }
+void ReserveProcessList(struct workload *workload, int capacity){
+    int **columns[WORKLOADCOLUMNS];                   /* The columns */
+    
+    /* There is nothing to do if the columns are already big enough */
+    if (capacity <= workload->capacity)
+        return;
+    
+    ColumnsOf(workload, columns);
+    for (int c = 0; c < WORKLOADCOLUMNS; c++) {
+        int *column = realloc(*columns[c], (size_t)capacity * sizeof(int)); /* The resized column */
+        if (!column){
+            ErrorMsg("'ReserveProcessList'", "Not enough memory for the process list");
+            exit(EXIT_FAILURE);
+        }
+        *columns[c] = column;
     }
+    
+    workload->capacity = capacity;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: Sort                                                       */
+/*  Function: GrowCapacity                                               */
 /*                                                                       */
-/*  Purpose: This function sorts the process list considering different  */
-/*           conditions for the sort. All the processes are sorted       */
-/*           using the 'Bubble Sort' algorithm. Actually, this function  */
-/*           does the same as SortListProcess, but it is needed since    */
-/*           in this function the start and the end condition are        */
-/*           not constant, and are recieved by the function              */
+/*  Purpose: Doubles a capacity until it holds what is needed, without   */
+/*           going over INT_MAX                                          */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The sort condition, the start and the end        */
-/*                      parameters of the sorting                        */
+/*            Input :   The capacity, what must fit and the function     */
+/*                      that grows                                       */
 /*                                                                       */
-/*            Output:   The main process list ordered by the condition   */
-/*                      that have been determined earlier, but may not   */
-/*                      be considering all the processes in the list for */
-/*                      the sort                                         */
+/*            Output:   The new capacity. If what is needed does not fit */
+/*                      in an int the program exits                      */
 /*                                                                       */
 /*************************************************************************/
-void Sort(int sortBy, int start, int end){
-    switch (sortBy) {
-            
-        /* This case considers only the CPU burst time for the sort */
-        case CPUBURST:
-            /* The process list will be sorted considering a start parameter 
-            and an end paramater */
-            for (int i = start; i < end; i++){
-                for (int j = i + 1; j < end; j++){
-                    /* If the CPU burst of the processes are the same, keep at top
-                     the process who it's Process ID is less */
-                    if (processList[i].cpuBurst == processList[j].cpuBurst){
-                        if (processList[i].pID > processList[j].pID){
-                            struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                       in order to not lose it during the exchange */
-
-                            processList[i] =  processList[j];
-                            processList[j] = temporal;
-                        }
-                    }
-                    /* Exchange the processes if the CPU burst time of the first process is higher than the second process */
-                    else if (processList[i].cpuBurst > processList[j].cpuBurst){
-                        struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                   in order to not lose it during the exchange */
-
-                        processList[i] =  processList[j];
-                        processList[j] = temporal;
-                    }
-                }
-            }
-            break;
-            
-        case PRIORITY:
-            for (int i = start; i < end; i++){
-                for (int j = i + 1; j < end; j++){
-                    /* If the priority of the processes are the same, keep at top
-                     the process who it's Process ID is less */
-                    if (processList[i].priority == processList[j].priority){
-                        if (processList[i].pID > processList[j].pID){
-                            struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                       in order to not lose it during the exchange */
-
-                            processList[i] =  processList[j];
-                            processList[j] = temporal;
-                        }
-                    }
-                    /* Exchange the processes if the Priority of the first process is lower than the second process */
-                    else if (processList[i].priority > processList[j].priority){
-                        struct process temporal = processList[i]; /* Create a temporal structure that stores a process
-                                                                  in order to not lose it during the exchange */
-
-                        processList[i] =  processList[j];
-                        processList[j] = temporal;
-                    }
-                }
-            }
-            break;
+static int GrowCapacity(int capacity, long long needed, char *function){
+    long long grown = capacity > 0 ? capacity : INITIALPROCESSES; /* The new capacity */
+    
+    if (needed > INT_MAX){
+        ErrorMsg(function, "There are more processes than can be simulated");
+        exit(EXIT_FAILURE);
     }
-
+    while (grown < needed)
+        grown *= 2;
+    
+    return (grown > INT_MAX ? INT_MAX : (int)grown);
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: ContextChanges                                             */
+/*  Function: FreeProcessList                                            */
 /*                                                                       */
-/*  Purpose: Prints the timeline of the context changes. It describes    */
-/*           which process is running at a particular time               */
+/*  Purpose: Releases the memory used by the columns of a workload       */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list and the number of processes     */
-/*                      that it contains                                 */
+/*            Input :   The workload                                     */
 /*                                                                       */
-/*            Output:   The context changes timeline                     */
+/*            Output:   An empty workload                                */
 /*                                                                       */
 /*************************************************************************/
-void ContextChanges(int numberOfProcesses, struct process processList[]){
-    for (int i = 0; i < numberOfProcesses; i++) {
-        /* The time that the process is executed */
-        printf("\n|        t    =   %2d        |\n", processList[i].firstExecuted);
-        /* This indicates which process is running at a specific time */
-        printf("|        Process: %2d        |\n", processList[i].pID);
-        printf(" --------------------------- ");
-        
+void FreeProcessList(struct workload *workload){
+    int **columns[WORKLOADCOLUMNS];                   /* The columns */
+    
+    ColumnsOf(workload, columns);
+    for (int c = 0; c < WORKLOADCOLUMNS; c++) {
+        free(*columns[c]);
+        *columns[c] = NULL;
     }
+    free(workload->cycles);
+    
+    workload->cycles = NULL;
+    workload->count = workload->capacity = 0;
+    workload->cycleCount = workload->cycleCapacity = 0;
 }
 
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CreateProcessList                                          */
+/*                                                                       */
+/*  Purpose: The function will be in charge to create the process list   */
+/*           of a workload                                               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The workload, and the process ID, arrival time,  */
+/*                      CPU burst, priority and deadline (or NODEADLINE) */
+/*                                                                       */
+/*            Output:   The process list of the workload                 */
+/*                                                                       */
+/*************************************************************************/
+void CreateProcessList(struct workload *workload, int pID, int arrivalTime, int cpuBurst, int priority, int deadline){
+    int i = workload->count;             /* Position of the new process */
+    
+    /* If the list is full, double it's capacity so the cost of growing is
+    spread over all the processes that are created */
+    if (workload->count == workload->capacity)
+        ReserveProcessList(workload, GrowCapacity(workload->capacity, workload->capacity + 1LL, "'CreateProcessList'"));
+    
+    /* All the paramaters obtained from the file are 
+    assigned to the new process */
+    workload->pID[i] = pID;
+    workload->arrivalTime[i] = arrivalTime;
+    workload->cpuBurst[i] = cpuBurst;
+    workload->priority[i] = priority;
+    workload->deadline[i] = deadline;
+    workload->cycle[i] = -1;
+    workload->count++; /* This variable is incremented in order to know how 
+                        many processes we will be working with */
+}
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: Treatment                                                  */
+/*  Function: AddProcessColumns                                          */
 /*                                                                       */
-/*  Purpose:  If a process does not arrive at time zero on preemptive    */
-/*            algorithms, it's applied a treatment in order to calculate */
-/*            the average waiting time considering that the first        */
-/*            process arrives at time zero                               */
+/*  Purpose: Adds many processes to a workload at once, copying every    */
+/*           one of their fields as a whole column, as they are stored   */
+/*           in a binary workload                                        */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list                                 */
+/*            Input :   The workload, the number of processes and the    */
+/*                      columns of their process IDs, arrival times, CPU */
+/*                      bursts, priorities and deadlines (or NULL if     */
+/*                      they have none)                                  */
 /*                                                                       */
-/*            Output:   The arrival time of the first process            */
+/*            Output:   The workload with the processes. If the memory   */
+/*                      can not be obtained the program exits            */
 /*                                                                       */
 /*************************************************************************/
-int Treatment(){
-    int firstArrival = 0; /* The arrival time of the first process */
-    /* If the arrival time of the first process is not zero, then obtain it's arrival time */
-    if (processList[0].arrivalTime > 0) {
-        firstArrival = processList[0].arrivalTime;
-        for (int i = 0; i < numberOfProcess; i++) {
-            /* Substract the arrival time of the first process to every process in the list (The actual 
-             treatment) */
-            processList[i].arrivalTime = processList[i].arrivalTime - firstArrival;
-        }
+void AddProcessColumns(struct workload *workload, int count, const int pID[], const int arrivalTime[], const int cpuBurst[],
+                       const int priority[], const int deadline[]){
+    int first = workload->count;   /* Position of the first new process */
+    
+    if (count <= 0)
+        return;
+    if ((long long)first + count > INT_MAX){
+        ErrorMsg("'AddProcessColumns'", "There are more processes than can be simulated");
+        exit(EXIT_FAILURE);
     }
+    ReserveProcessList(workload, first + count);
     
-    return firstArrival;
+    memcpy(workload->pID + first, pID, (size_t)count * sizeof(int));
+    memcpy(workload->arrivalTime + first, arrivalTime, (size_t)count * sizeof(int));
+    memcpy(workload->cpuBurst + first, cpuBurst, (size_t)count * sizeof(int));
+    memcpy(workload->priority + first, priority, (size_t)count * sizeof(int));
+    for (int i = first; i < first + count; i++) {
+        workload->deadline[i] = deadline ? deadline[i - first] : NODEADLINE;
+        workload->cycle[i] = -1;
+    }
+    workload->count += count;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: InverseTreatment                                           */
+/*  Function: AddProcessCycles                                           */
 /*                                                                       */
-/*  Purpose:  If a process does not arrive at time zero on preemptive    */
-/*            algorithms, it's applied a treatment in order to calculate */
-/*            the average waiting time considering that the first        */
-/*            process arrives at time zero. This function returns the    */
-/*            process list to it's original state of arrival times, with */
-/*            the purpose to be printed on the context changes timeline  */
+/*  Purpose: Gives the last process created in a workload more cycles of */
+/*           an I/O burst followed by a CPU burst. It's first CPU burst  */
+/*           is the one it was created with, and it's CPU burst becomes  */
+/*           the sum of all of them                                      */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The arrival time of the process and the number   */
-/*                      of processes that are in the list                */
+/*            Input :   The workload, the bursts, alternating I/O and    */
+/*                      CPU, all positive and with a total CPU that fits */
+/*                      in an int, and their number, which is even       */
 /*                                                                       */
-/*            Output:   The list within it's original arrival times      */
+/*            Output:   The cycles of the workload with the process. If  */
+/*                      the memory can not be obtained the program exits */
 /*                                                                       */
 /*************************************************************************/
-void InverseTreatment(int firstArrival,  int numberOfProcesses){
-    for (int i = 0; i < numberOfProcesses; i++)
-        /* Since this is only used for the context changes timeline, the arrival times are not modified 
-         directly, instead, are modified through the first executed parameter */
-        contextProcessList[i].firstExecuted = contextProcessList[i].firstExecuted + firstArrival;
+void AddProcessCycles(struct workload *workload, const int *bursts, int count){
+    int last = workload->count - 1;     /* Position of the last process */
+    
+    /* The cycles grow like the process list, and keep the first CPU burst and the 0 at the end */
+    if (workload->cycleCount + count + 2LL > workload->cycleCapacity) {
+        int capacity = GrowCapacity(workload->cycleCapacity, workload->cycleCount + count + 2LL, "'AddProcessCycles'");
+        int *cycles;                                /* The resized cycles */
+        
+        cycles = realloc(workload->cycles, (size_t)capacity * sizeof(int));
+        if (!cycles) {
+            ErrorMsg("'AddProcessCycles'", "Not enough memory for the I/O cycles");
+            exit(EXIT_FAILURE);
+        }
+        workload->cycles = cycles;
+        workload->cycleCapacity = capacity;
+    }
+    
+    workload->cycle[last] = workload->cycleCount;
+    workload->cycles[workload->cycleCount++] = workload->cpuBurst[last];
+    for (int i = 0; i < count; i++) {
+        workload->cycles[workload->cycleCount++] = bursts[i];
+        if (i % 2 == 1)
+            workload->cpuBurst[last] += bursts[i];
+    }
+    workload->cycles[workload->cycleCount++] = 0;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: CopyProcessList                                            */
+/*  Function: ProcessColumn                                              */
 /*                                                                       */
-/*  Purpose:  Create a copy of the main list of processes                */
+/*  Purpose: Obtains the column of a workload with one of the fields of  */
+/*           every process, as named by the process keys used for the    */
+/*           sorting. It is stored as in a binary workload               */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The main process list                            */
+/*            Input :   The workload and the key of the field            */
 /*                                                                       */
-/*            Output:   An intact copy of the main process list          */
+/*            Output:   The column, with one value per process           */
 /*                                                                       */
 /*************************************************************************/
-void CopyProcessList(){
-     /* Copy all elements in the list*/
-    for (int i = 0; i < numberOfProcess; i++)
-        processListCopy[i] = processList[i];
+const int *ProcessColumn(const struct workload *workload, int field){
+    switch (field) {
+        case ARRIVALTIME:
+            return workload->arrivalTime;
+        case CPUBURST:
+            return workload->cpuBurst;
+        case PRIORITY:
+            return workload->priority;
+        case DEADLINE:
+            return workload->deadline;
+        default:
+            return workload->pID;
+    }
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: RestoreProcessList                                         */
+/*  Function: CompareSortKeys                                            */
 /*                                                                       */
-/*  Purpose:  Restore the main list of processes through the contents    */
-/*            of a previous made copy                                    */
+/*  Purpose: Compares two entries of the sort when their fields do not   */
+/*           fit in a single packed key. It is used by qsort             */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The main process list                            */
+/*            Input :   The two entries to compare                       */
 /*                                                                       */
-/*            Output:   The main process list within it's original       */
-/*                      contents                                         */
+/*            Output:   A negative, zero or positive value if the first  */
+/*                      entry goes before, together or after the second  */
 /*                                                                       */
 /*************************************************************************/
-void RestoreProcessList(){
-    for (int i = 0; i < numberOfProcess; i++)
-        processList[i] = processListCopy[i];
+static int CompareSortKeys(const void *first, const void *second){
+    const struct sortKey *a = first, *b = second;   /* The two entries */
+    
+    for (int i = 0; i < SORTFIELDS; i++)
+        if (a->fields[i] != b->fields[i])
+            return (a->fields[i] < b->fields[i] ? -1 : 1);
+    
+    return 0;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: WaitTime                                                   */
+/*  Function: SortRange                                                  */
 /*                                                                       */
-/*  Purpose: Obtains the average wait time of all the processes. It      */
-/*           is in charge to obtain the waiting time and the first       */
-/*           execution of every process                                  */
+/*  Purpose: Sorts a range of the processes of a workload by a list of   */
+/*           fields, the first one being the most important. The fields  */
+/*           of every process are packed into a single 64 bit key, using */
+/*           only the bits needed by the range of values of each field,  */
+/*           and the keys are ordered with a LSD radix sort over the     */
+/*           positions of the processes. The fields are read from their  */
+/*           columns, and only when all the processes have been ordered  */
+/*           is every column moved, once, to it's final order. If the    */
+/*           fields need more than 64 bits, qsort is used instead        */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list, the number of processes that   */
-/*                      it contains and if, it's called on a preemptive  */
-/*                      algorithm, the arrival time of the first process */
+/*            Input :   The workload, the fields for the sort, how many  */
+/*                      they are and the start and the end of the range  */
 /*                                                                       */
-/*            Output:   The average wait time of all the processes       */
+/*            Output:   The range of the workload ordered                */
 /*                                                                       */
 /*************************************************************************/
-void WaitTime(int numberOfProcesses, struct process processList[], int firstArrival){
-    
+static void SortRange(struct workload *workload, const int fields[], int numberOfFields, int start, int end){
+    int n = end - start;                 /* Processes in the range to sort */
+    int minimum[SORTFIELDS], bits[SORTFIELDS];   /* Range of every field */
+    int totalBits = 0;                     /* Bits needed by a packed key */
+    int *order, *orderTemporal;          /* Positions of the processes */
+    int **columns[WORKLOADCOLUMNS];          /* The columns to reorder */
+    unsigned long long *keys, *keysTemporal;           /* The packed keys */
+    int *temporal;                  /* A column in it's new order */
     
-    float averageWaitTime = 0.0; /* The variable that will store the average
-                                waiting time */
+    if (n < 2)
+        return;
     
+    /* Find how many bits are needed to tell apart the values of every field, scanning it's column */
+    for (int f = 0; f < numberOfFields; f++) {
+        const int *column = ProcessColumn(workload, fields[f]) + start; /* The field */
+        int maximum;
+        
+        minimum[f] = maximum = column[0];
+        for (int i = 1; i < n; i++) {
+            if (column[i] < minimum[f])
+                minimum[f] = column[i];
+            if (column[i] > maximum)
+                maximum = column[i];
+        }
+        
+        bits[f] = 0;
+        while (bits[f] < 32 && ((unsigned)maximum - (unsigned)minimum[f]) >> bits[f])
+            bits[f]++;
+        totalBits += bits[f];
+    }
     
-    processList[0].waitTime = 0; /* Since the first process in the list always
-                                  executes at arrival, it's waiting time it's always zero */
+    order = malloc((size_t)n * sizeof(int));
+    if (!order) {
+        ErrorMsg("'SortRange'", "Not enough memory for the sort");
+        exit(EXIT_FAILURE);
+    }
     
-    processList[0].firstExecuted = processList[0].arrivalTime; /* The first time that the
-                                                                initial process is executed is
-                                                                when it arrives */
-    for (int i = 1; i < numberOfProcesses; i++) {
+    if (totalBits <= 64) {
+        keys = malloc((size_t)n * sizeof(unsigned long long));
+        keysTemporal = malloc((size_t)n * sizeof(unsigned long long));
+        orderTemporal = malloc((size_t)n * sizeof(int));
+        if (!keys || !keysTemporal || !orderTemporal) {
+            ErrorMsg("'SortRange'", "Not enough memory for the sort");
+            exit(EXIT_FAILURE);
+        }
+        
+        /* Pack the fields of every process, the most important one in the highest bits, one column at a time */
+        for (int i = 0; i < n; i++) {
+            keys[i] = 0;
+            order[i] = i;
+        }
+        for (int f = 0; f < numberOfFields; f++) {
+            const int *column = ProcessColumn(workload, fields[f]) + start; /* The field */
+            
+            if (bits[f] == 0)
+                continue;
+            for (int i = 0; i < n; i++)
+                keys[i] = (keys[i] << bits[f]) | ((unsigned)column[i] - (unsigned)minimum[f]);
+        }
+        
+        /* Sort one byte at a time, starting with the least significant one. Each pass is stable, so the order of the previous bytes
+         is kept for the processes that share this byte. A byte that is the same for every process is skipped */
+        for (int shift = 0; shift < totalBits; shift += 8) {
+            int count[257] = {0};                   /* Processes per byte value */
+            unsigned long long *swapKeys;
+            int *swapOrder;
+            
+            for (int i = 0; i < n; i++)
+                count[((keys[i] >> shift) & 0xFF) + 1]++;
+            if (count[((keys[0] >> shift) & 0xFF) + 1] == n)
+                continue;
+            for (int d = 0; d < 256; d++)
+                count[d + 1] += count[d];
+            
+            for (int i = 0; i < n; i++) {
+                int position = count[(keys[i] >> shift) & 0xFF]++;
+                keysTemporal[position] = keys[i];
+                orderTemporal[position] = order[i];
+            }
+            
+            swapKeys = keys; keys = keysTemporal; keysTemporal = swapKeys;
+            swapOrder = order; order = orderTemporal; orderTemporal = swapOrder;
+        }
+        
+        free(keys);
+        free(keysTemporal);
+        free(orderTemporal);
+    }
+    else {
+        struct sortKey *entries = malloc((size_t)n * sizeof(struct sortKey)); /* The fields of every process */
+        const int *sortColumns[SORTFIELDS];        /* The fields for the sort */
+        
+        if (!entries) {
+            ErrorMsg("'SortRange'", "Not enough memory for the sort");
+            exit(EXIT_FAILURE);
+        }
         
-        /* The first time that a process is executed is when previous processes finishes its execution */
-        processList[i].firstExecuted = processList[i-1].cpuBurst + processList[i-1].firstExecuted;
+        for (int f = 0; f < numberOfFields; f++)
+            sortColumns[f] = ProcessColumn(workload, fields[f]) + start;
+        for (int i = 0; i < n; i++) {
+            for (int f = 0; f < SORTFIELDS; f++)
+                entries[i].fields[f] = f < numberOfFields ? sortColumns[f][i] : 0;
+            entries[i].index = i;
+        }
+        
+        qsort(entries, (size_t)n, sizeof(struct sortKey), CompareSortKeys);
         
-        /* The wait time of a process can be found if at its first execution it is substracted the process arrival time */
-        processList[i].waitTime = processList[i].firstExecuted - processList[i].arrivalTime - processList[i - 1].lastExecuted;;
+        for (int i = 0; i < n; i++)
+            order[i] = entries[i].index;
+        free(entries);
     }
     
-    for (int i = 0; i < numberOfProcesses; i++){
-        /* All of the waiting times of each process is obtained and
-         stored in one only variable */
-        averageWaitTime = averageWaitTime + processList[i].waitTime;
+    /* Move every process to it's place, one column at a time through a temporal column */
+    temporal = malloc((size_t)n * sizeof(int));
+    if (!temporal) {
+        ErrorMsg("'SortRange'", "Not enough memory for the sort");
+        exit(EXIT_FAILURE);
+    }
+    ColumnsOf(workload, columns);
+    for (int c = 0; c < WORKLOADCOLUMNS; c++) {
+        int *column = *columns[c] + start;             /* The column */
+        
+        for (int i = 0; i < n; i++)
+            temporal[i] = column[order[i]];
+        memcpy(column, temporal, (size_t)n * sizeof(int));
     }
     
-    /* The sum is divided by the number of processes in order to obtain 
-    the average waiting time */
-    averageWaitTime = averageWaitTime / numberOfProcess;
-    
-    /* Since the average waiting time of the preemptive algorithms, is calculated considering that the first process arrives 
-     at time zero, then if the arrival time of the first process is not zero, a treatment to the data is applied in order to
-     print the actual times of the context changes */
-    if (firstArrival != 0)
-        InverseTreatment(firstArrival, numberOfProcesses);
-
-    ContextChanges(numberOfProcesses, processList); /* Print the context changes */
-    printf("\n|                           |");
-    printf("\n| Average Wait Time:  %.2f  |\n", averageWaitTime); /* The average waiting time is shown */
-    printf("|                           |\n");
-    printf(" ---------------------------\n\n");
+    free(temporal);
+    free(order);
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: FirstComeFS                                                */
+/*  Function: SortProcessList                                            */
 /*                                                                       */
-/*  Purpose: Generates the wait time for each of the processes using     */
-/*           the First Come First Served algorithm                       */
+/*  Purpose: This function sorts the process list considering different  */
+/*           conditions for the sort. The processes are always ordered   */
+/*           by arrival time; the processes that arrive at the same time */
+/*           are ordered by the condition (the lowest CPU burst or the   */
+/*           highest priority), and the remaining ties by process ID     */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list which in will be computing the  */
-/*                      average wait time                                */
+/*            Input :   The workload and the sort condition              */
 /*                                                                       */
-/*            Output:   All the process list information considering the */
-/*                      average wait time and the context changes        */
+/*            Output:   The process list ordered by the condition        */
+/*                      that have been determined earlier                */
 /*                                                                       */
 /*************************************************************************/
-void FirstComeFS(){
+void SortProcessList(struct workload *workload, int sortBy){
+    int fields[SORTFIELDS] = {ARRIVALTIME, sortBy, PID}; /* The fields for the sort, from the most important one */
     
-    printf(" ---------------------------\n");
-    printf("|  First Come First Served  |\n");
-    printf(" ---------------------------");
+    /* The arrival time and the process ID are only needed once */
+    if (sortBy == ARRIVALTIME || sortBy == PID) {
+        fields[1] = PID;
+        SortRange(workload, fields, 2, 0, workload->count);
+    }
+    else
+        SortRange(workload, fields, 3, 0, workload->count);
+}
 
-    WaitTime(numberOfProcess, processList, 0); /* The average waiting time is obtained */
+/*************************************************************************/
+/*                                                                       */
+/*  Function: InitSimulation                                             */
+/*                                                                       */
+/*  Purpose: Prepares a simulation context over a workload. The context  */
+/*           keeps all the state of the algorithms, so many simulations  */
+/*           can run at the same time, even over the same workload,      */
+/*           which is only read                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The context, the workload (or NULL if the        */
+/*                      processes are streamed), where to write the      */
+/*                      report and it's format                           */
+/*                                                                       */
+/*            Output:   The context, with empty queues                   */
+/*                                                                       */
+/*************************************************************************/
+void InitSimulation(struct simulation *simulation, const struct workload *workload, FILE *out, int format){
+    simulation->workload = workload;
+    simulation->next = 0;
+    simulation->trace = NULL;
+    OpenReport(&simulation->report, out, format);
+    simulation->result = (struct simulationResult){0};
+    InitReadyQueue(&simulation->ready, 0);
+    InitRunQueue(&simulation->run, 0);
+    simulation->pool = (struct processPool){0};
+    simulation->feedback = (struct feedback){.levels = DEFAULTLEVELS, .boost = -1};
+    simulation->fairness = (struct fairness){0};
+    simulation->costs = (struct switchCosts){0};
+    simulation->deadlines = ABSOLUTEDEADLINES;
+    simulation->cores = NULL;
+    simulation->devices = NULL;
+    simulation->start = 0;
+    simulation->machine.cpus = simulation->machine.devices = 0;
+    simulation->latencies = malloc(sizeof(struct latencies));
+    if (!simulation->latencies) {
+        ErrorMsg("'InitSimulation'", "Not enough memory for the histograms");
+        exit(EXIT_FAILURE);
+    }
+    SetMachine(simulation, &(struct machine){.cpus = 1, .policy = GLOBALQUEUE, .devices = 1});
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: NonPreemptive                                              */
+/*  Function: FreeSimulation                                             */
 /*                                                                       */
-/*  Purpose: Generates the wait time for each of the processes using     */
-/*           the Non Preemptive algorithms                               */
+/*  Purpose: Releases the queues, the CPUs, the devices, the histograms, */
+/*           the pool and the report of a simulation context. The        */
+/*           workload and the file of the report belong to the caller    */
+/*           and are not released                                        */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list which in will be computing the  */
-/*                      average wait time and the algorithm that is      */
-/*                      going to be used for the procedure               */
+/*            Input :   The context                                      */
 /*                                                                       */
-/*            Output:   All the process list information considering the */
-/*                      average wait time and the context changes        */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void FreeSimulation(struct simulation *simulation){
+    FreeReadyQueue(&simulation->ready);
+    FreeRunQueue(&simulation->run);
+    for (int cpu = 0; cpu < simulation->machine.cpus; cpu++) {
+        FreeReadyQueue(&simulation->cores[cpu].ready);
+        FreeRunQueue(&simulation->cores[cpu].run);
+        FreeLevelQueue(&simulation->cores[cpu].levels);
+    }
+    free(simulation->cores);
+    simulation->cores = NULL;
+    for (int device = 0; device < simulation->machine.devices; device++)
+        FreeRunQueue(&simulation->devices[device].queue);
+    free(simulation->devices);
+    simulation->devices = NULL;
+    free(simulation->latencies);
+    simulation->latencies = NULL;
+    CloseReport(&simulation->report);
+    free(simulation->pool.processes);
+    free(simulation->pool.freeSlots);
+    simulation->pool = (struct processPool){0};
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: DispatchPolicy                                             */
+/*                                                                       */
+/*  Purpose: Finds a policy to give the processes to the CPUs by it's    */
+/*           name                                                        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name: global or steal                        */
+/*                                                                       */
+/*            Output:   The policy, or -1 if the name is unknown         */
 /*                                                                       */
 /*************************************************************************/
-void NonPreemptive(int algorithm){
+int DispatchPolicy(const char *name){
+    for (int policy = 0; policy < NUMPOLICIES; policy++)
+        if (strcmp(name, policies[policy]) == 0)
+            return policy;
     
-    int lastProcess = 0; /* This variable stores which will be the last process consider in the sorting */
-    int burst = 0; /* This stores an accumulated of the CPU burst times of the processes in order to know
-                    which processes have arrived and can be included in the sorting */
-    SortProcessList(ARRIVALTIME); /* Order all the processes in the list considering it's arrival time */
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: SetMachine                                                 */
+/*                                                                       */
+/*  Purpose: Sets the number of CPUs of a simulation and how the         */
+/*           processes are given to them. Every CPU gets it's own queues, */
+/*           which are only used when the policy is work stealing, and   */
+/*           every I/O device gets it's own FIFO queue                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the machine, with at least    */
+/*                      one CPU and at most MAXCPUS, and at least one    */
+/*                      device and at most MAXDEVICES                    */
+/*                                                                       */
+/*            Output:   The simulation with the CPUs and the devices     */
+/*                                                                       */
+/*************************************************************************/
+void SetMachine(struct simulation *simulation, const struct machine *machine){
+    struct core *cores;                                  /* The new CPUs */
+    struct device *devices;                           /* The new devices */
     
-    switch (algorithm) {
-        case CPUBURST:
-            /* Print a header */
-            printf(" ---------------------------\n");
-            printf("|     SJF Non Preemptive    |\n");
-            printf(" ---------------------------");
-            
-            /* In case there are processes in the list that arrives on the same time at the very beginning, order
-            only them considering the lowest CPU burst time of each other */
-            SortProcessList(CPUBURST);
-        break;
-            
-        case PRIORITY:
-            /* Print a header */
-            printf(" ---------------------------\n");
-            printf("|  Priority Non Preemptive  |\n");
-            printf(" ---------------------------");
-            
-            /* In case there are processes in the list that arrives on the same time at the very beginning, order
-             only them considering the highest priority of each other */
-            SortProcessList(PRIORITY);
-        break;
+    for (int cpu = 0; cpu < simulation->machine.cpus; cpu++) {
+        FreeReadyQueue(&simulation->cores[cpu].ready);
+        FreeRunQueue(&simulation->cores[cpu].run);
+        FreeLevelQueue(&simulation->cores[cpu].levels);
     }
+    for (int device = 0; device < simulation->machine.devices; device++)
+        FreeRunQueue(&simulation->devices[device].queue);
     
-    /* In the Non Preemptive algorithms, the order of execution of the processes can be seen as a simple reordered list. In that case, 
-     the processes are ordered considering it's arrival time versus the processes who have been executed already or are being executed */
-    for (int i = 0; i < numberOfProcess; i++) {
-        
-        lastProcess = 0; /* Reset the last process variable */
-        burst += processList[i].cpuBurst; /* Store an accumulated of the CPU burst times of the processes in order to know
-                                                  which processes have arrived and can be included in the sorting */
-        
-        for (int j = i + 1; j < numberOfProcess; j++) {
-            /* If the accumulated of the burst is lower than the arrival time of the next process, it means that that process
-             have not arrived and can not be included in the sorting */
-            
-            if (burst < processList[j].arrivalTime) {
-                lastProcess = j; /* Indicate which will be the last process consider for the sorting */
-                j = numberOfProcess; /* Break the inner cycle. Since the processes are ordered initially considering it's arrival time, if one 
-                                      process arrives after the execution of another process, then all the processes which came after, will
-                                      have a higher arrival time and there is no reason to consider them again */
-            }
-        }
-        /* If the last process is zero, then it means that all processes can be included in the sort since them have already arrived */
-        if (lastProcess == 0) {
-            Sort(algorithm, i + 1, numberOfProcess); /* Sort the process considering the algorithm that have been indicated earlier. Since
-                                                      the "i" process is already being executed, then the start parameter for the sorting,
-                                                      is the next process. All the processes are being consider for the sorting, so the 
-                                                      end parameter corresponds to the number of processes that are in the main list */
-            
-            i = numberOfProcess; /* Finish the ordering process since we can conclude that all the processes have arrived and have been
-                                  included in the sort */
-        }
-        else
-            Sort(algorithm, i + 1, lastProcess); /* Sort the process considering the algorithm that have been indicated earlier. Since
-                                                  the "i" process is already being executed, then the start parameter for the sorting,
-                                                  is the next process. It is indicated which will be the last process considered in the
-                                                  sorting */
+    cores = realloc(simulation->cores, (size_t)machine->cpus * sizeof(struct core));
+    if (cores)
+        simulation->cores = cores;
+    devices = realloc(simulation->devices, (size_t)machine->devices * sizeof(struct device));
+    if (devices)
+        simulation->devices = devices;
+    if (!cores || !devices) {
+        ErrorMsg("'SetMachine'", "Not enough memory for the CPUs and the devices");
+        exit(EXIT_FAILURE);
     }
+    for (int cpu = 0; cpu < machine->cpus; cpu++) {
+        InitReadyQueue(&cores[cpu].ready, 0);
+        InitRunQueue(&cores[cpu].run, 0);
+        InitLevelQueue(&cores[cpu].levels);
+    }
+    for (int device = 0; device < machine->devices; device++)
+        InitRunQueue(&devices[device].queue, 0);
     
-    WaitTime(numberOfProcess, processList, 0); /* Calculate the average waiting time */
+    simulation->machine = *machine;
+    simulation->report.cpus = machine->cpus;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: Preemptive                                                 */
+/*  Function: ListRead                                                   */
 /*                                                                       */
-/*  Purpose: Generates the wait time for each of the processes using     */
-/*           the Preemptive algorithms                                   */
+/*  Purpose: Gives the processes of the workload of a simulation, which  */
+/*           is already ordered by arrival time, one at a time. It is    */
+/*           the source used when all the processes have been read       */
+/*           before the simulation                                       */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list which in will be computing the  */
-/*                      average wait time and the algorithm that is      */
-/*                      going to be used for the procedure               */
+/*            Input :   The simulation and where to store the process    */
 /*                                                                       */
-/*            Output:   All the process list information considering the */
-/*                      average wait time and the context changes        */
+/*            Output:   1 if a process was given, 0 at the end of list   */
 /*                                                                       */
 /*************************************************************************/
-void Preemptive(int algorithm){
-    
-    SortProcessList(ARRIVALTIME); /* Order all the processes in the list considering it's arrival time */
-    CopyProcessList(); /* Since the main process list it's going to change, it's created a copy of it */
-    
-    int firstArrival = Treatment(); /* It's obtained the arrival time of the first process */
+static int ListRead(void *data, struct process *process){
+    struct simulation *simulation = data;            /* The simulation */
+    const struct workload *workload = simulation->workload; /* The columns */
+    int i = simulation->next;                 /* Position of the process */
     
-    int burst = 0; /* This stores an accumulated of the CPU burst times of the processes in order to know
-                    which processes have arrived and can be included in the sorting */
+    if (i == workload->count)
+        return 0;
     
-    int processRunning = 0; /* This variable indicates which process is being executed and is used to know
-                             how many processes have finished it's execution */
-    
-    int interrumptions = 0; /* This counter indicates how many interrumptions have take place through all the process */
-    
-    int lastProcess = 0;  /* This variable stores which will be the last process consider in the sorting */
-    
-    int doubleInterrumptions = 0; /* This counter stores how many interruptions of the interruptions are made */
-    
-    int displacer = 0; /* This displacer is used in order to compare new incoming processes */
-    
-    int time = 0; /* This variable stores all the execution time at a specific point */
-    
-    int displacerCondition = 1; /* This is a switch indicating if a displace must be donde in order to not compromise the correct
-                                 functionality of the procedure */
-    
-    
-    switch (algorithm) {
-        case CPUBURST:
-            /* Print a header */
-            printf(" ---------------------------\n");
-            printf("|       SJF Preemptive      |\n");
-            printf(" ---------------------------");
-            
-            /* In case there are processes in the list that arrives on the same time at the very beginning, order
-             only them considering the lowest CPU burst time of each other */
-            SortProcessList(CPUBURST);
-            
-            /* Repeat the procedure until the procesess completed are equal to the number of processes in the list minus 1 */
-            while (processRunning < numberOfProcess - 1) {
-                /* Reset the variables */
-                lastProcess = 0;
-                burst = 0;
-                doubleInterrumptions = 0;
-                displacer = 0;
-                
-                /* Store an accumulated of the CPU burst times of the processes of a second process list in order to know
-                 which processes have arrived and can be included in the sorting */
-                for (int i = 0; i < processRunning + interrumptions; i++) {
-                    burst += contextProcessList[i].cpuBurst;
-                }
-                /* If it's the first time that this procedure is being executed, ignore it. Else, indicate how many process have arrived
-                 and can be included in the sorting through the last process variable */
-                if (burst != 0) {
-                    
-                    /* Start in the number of the process running, since we do not want to include in the sorting, processes that have
-                     been already executed totally */
-                    for (int k = processRunning; k < numberOfProcess; k++) {
-                        if (burst >= processList[k].arrivalTime)
-                            lastProcess = k; /* Indicate which will be the last process consider for the sorting */
-                    }
-                    
-                    /* If the last process is not zero, then it means that a sorting must be done, since we must indicate which will
-                     be the next process to be executed */
-                    if(lastProcess != 0)
-                        Sort(CPUBURST, processRunning, lastProcess + 1);/* Sort the process considering the algorithm that have been indicated earlier.                  The process that is going to be executed must be included in the sorting. It is indicated which will be the last process considered in the sorting. Since the comparison in the sorting is made through the operator '<' a '+1' is send in the parameter section */
-                }
-                
-                /* This is a condition indicating if a displace must be done in order to not compromise the correct
-                 functionality of the procedure. It is considered that if the next process have already been executed, and it's found after
-                 the process that is consider to be executed next, then ignore it. Also, if the next process has the same time than the process
-                 to be executed, it have been already validated that process has a higher CPU burst time, so it could be ignored in order
-                 to start with the next process. The condition of the "processRunning < numberOfProcess - 2 - displacer" is used in order to
-                 evade overflow conditions in the process list */
-                while (displacerCondition == 1) {
-                    if ((processList[processRunning + 1 + doubleInterrumptions + displacer].lastExecuted != 0 && processRunning < numberOfProcess - 2 - displacer) ||  (processList[processRunning].arrivalTime == processList[processRunning + 1 + doubleInterrumptions + displacer].arrivalTime && processRunning < numberOfProcess - 2 - displacer)){
-                        displacer++;
-                    }
-                    else
-                        displacerCondition = 0;
-                }
-                
-                /* Initiate the reordering and interruptions procedure. This will simulate that the processes are being executed over time
-                 so this will be done until all the cpu burst time of a process expires. Since the operator used for the comparison is a '<' a "+1" is
-                 included in the comparison */
-                for (int j = 1; j < processList[processRunning].cpuBurst + 1; j++) {
-                    
-                    time++; /* Increase the time */
-                    
-                    processList[processRunning].lastExecuted = j; /* This indicates how much time the process have been executed */
-                    
-                    /* If the execution time is higher or equal to the next process arrival time, then it means that process have arrived at
-                     this point, so this one can either interrupt or not the process that being executed. The "doubleInterrumptions", the "displacer" and
-                     the "processRunning" variables helps to indicate the next better process that can be compared to */
-                    if (time >= processList[processRunning + 1 + doubleInterrumptions + displacer].arrivalTime) {
-                        
-                        /* If the CPU burst time of the process that is being executed, consider the time that has already executed, is higher than
-                         the next better process in the list, there must be an interruption */
-                        if (processList[processRunning].cpuBurst - j > processList[processRunning + 1 + doubleInterrumptions + displacer].cpuBurst) {
-                            
-                            /* Store the information of the process that is being executed on a new process list. The "interruptions" let us
-                             create new information about processes interrupted in the list */
-                            contextProcessList[processRunning + interrumptions] = processList[processRunning];
-                            
-                            /* Since this code is only executed when there is an interruption, we must indicate that the new process in the new list,
-                             have only executed a partial time of it's CPU burst, which is stored in the last executed parameter */
-                            contextProcessList[processRunning + interrumptions].cpuBurst = contextProcessList[processRunning + interrumptions].lastExecuted;
-                            
-                            /* It's indicated that the CPU burst now have reduced since it have been executed before "j" time unities */
-                            processList[processRunning].cpuBurst -= j;
-                            
-                            /* Create a temporal structure that stores a process
-                             in order to not lose it during the exchange */
-                            struct process temporal = processList[processRunning];
-                            
-                            /* Exchange the process which is running with which one who have interrupted */
-                            processList[processRunning] =  processList[processRunning + 1 + displacer + doubleInterrumptions];
-                            processList[processRunning + 1 + displacer + doubleInterrumptions] = temporal;
-                            
-                            doubleInterrumptions++; /* Increase this variable to indicate that an interruption have been made and the next process in
-                                                     the list must not be compared to */
-                            
-                            /* If the arrival time of the next process is the same, then you increase the variable "doubleInterruptions". Since
-                             the processes with the same arrival time have been ordered before, and the next process in the list could have an arrival
-                             time of just one unity of time higher than the process that is going to execute, we must validate it's information, not
-                             the process that we already know it has a higher CPU burst time */
-                            if(processList[processRunning].arrivalTime == processList[processRunning + 1 + displacer + doubleInterrumptions].arrivalTime)
-                                doubleInterrumptions++;
-                            
-                            j = 0; /* Reset this variable since a new process is going to execute */
-                            displacer = 0; /* Reset this variable for the same reason as before */
-                            interrumptions++; /* Indicate that a new interrumption has been made */
-                        }
-                        else{
-                            /* If the process that we are comparing to have been arrived but it has a higher CPU burst time, there is no reason
-                             to be stuck at it, so a displacer variable is increased. Since this can overflow the process list elements, it is
-                             used the mod function. It must be substracted the "processRunning" and the "doubleInterruptions" since there can
-                             overflow the process list too */
-                            displacer = (displacer + 1) % (numberOfProcess - (processRunning + doubleInterrumptions + 1));
-                        }
-                    }
-                    /* Since there can be a lot of interruptions of interruptions, we must return to it's initial value in order to not
-                     overflow the main process list. It is compared to the "number of process - 1" since this is the value which will overflow the
-                     process list */
-                    if (doubleInterrumptions >= numberOfProcess - 1) {
-                        doubleInterrumptions = 0; /* Reset this variable */
-                    }
-                }
-                
-                /* If the CPU burst of the process that is being executed is equals to the unities that have been executed, then this means
-                 that the process have finished it's execution time */
-                if (processList[processRunning].cpuBurst == processList[processRunning].lastExecuted) {
-                    /* We store the process information in the other list */
-                    contextProcessList[processRunning + interrumptions] = processList[processRunning];
-                    
-                    /* The last executed parameter is deleted, since this is used for the calcutions of the average time and it must be only
-                     kept during interruptions */
-                    contextProcessList[processRunning + interrumptions].lastExecuted = 0;
-                    processRunning++; /* It's indicated that a process have finished */
-                }
-            }
-        break;
-            
-        case PRIORITY:
-            /* Print a header */
-            printf(" ---------------------------\n");
-            printf("|    Priority Preemptive    |\n");
-            printf(" ---------------------------");
-            
-            
-            /* In case there are processes in the list that arrives on the same time, order
-             only them considering the highest priority of each other */
-            SortProcessList(PRIORITY);
-
-            /* Repeat the procedure until the procesess completed are equal to the number of processes in the list minus 1 */
-            while (processRunning < numberOfProcess - 1) {
-                /* Reset the variables */
-                lastProcess = 0;
-                burst = 0;
-                doubleInterrumptions = 0;
-                displacer = 0;
-                displacerCondition = 1;
-                
-                /* Store an accumulated of the CPU burst times of the processes of a second process list in order to know
-                 which processes have arrived and can be included in the sorting */
-                for (int i = 0; i < processRunning + interrumptions; i++) {
-                    burst += contextProcessList[i].cpuBurst;
-                }
-                /* If it's the first time that this procedure is being executed, ignore it. Else, indicate how many process have arrived
-                 and can be included in the sorting through the last process variable */
-                if (burst != 0) {
-                    
-                    /* Start in the number of the process running, since we do not want to include in the sorting, processes that have
-                     been already executed totally */
-                    for (int k = processRunning; k < numberOfProcess; k++) {
-                        if (burst >= processList[k].arrivalTime)
-                            lastProcess = k; /* Indicate which will be the last process consider for the sorting */
-                    }
-                    
-                    /* If the last process is not zero, then it means that a sorting must be done, since we must indicate which will
-                     be the next process to be executed */
-                    if(lastProcess != 0)
-                        Sort(PRIORITY, processRunning, lastProcess + 1);/* Sort the process considering the algorithm that have been indicated earlier. The process that is going to be executed must be included in the sorting. It is indicated which will be the last process considered in the sorting. Since the comparison in the sorting is made through the operator '<' a '+1' is send in the parameter section */
-                }
-                
-                
-                /* This is a condition indicating if a displace must be done in order to not compromise the correct
-                 functionality of the procedure. It is considered that if the next process have already been executed, and it's found after
-                 the process that is consider to be executed next, then ignore it. Also, if the next process has the same time than the process
-                 to be executed, it have been already validated that process has a higher CPU burst time, so it could be ignored in order
-                 to start with the next process. The condition of the "processRunning < numberOfProcess - 2 - displacer" is used in order to 
-                 evade overflow conditions in the process list */
-                while (displacerCondition == 1) {
-                    if ((processList[processRunning + 1 + doubleInterrumptions + displacer].lastExecuted != 0 && processRunning < numberOfProcess - 2 - displacer) ||  (processList[processRunning].arrivalTime == processList[processRunning + 1 + doubleInterrumptions + displacer].arrivalTime && processRunning < numberOfProcess - 2 - displacer)){
-                        displacer++;
-                    }
-                else
-                    displacerCondition = 0;
-                }
-                /* Initiate the reordering and interruptions procedure. This will simulate that the processes are being executed over time
-                 so this will be done until all the cpu burst time of a process expires. Since the operator used for the comparison is a '<' a "+1" is
-                 included in the comparison */
-                for (int j = 1; j < processList[processRunning].cpuBurst + 1; j++) {
-                    
-                    time++; /* Increase the time */
-                    
-                    processList[processRunning].lastExecuted = j; /* This indicates how much time the process have been executed */
-                    
-                    /* If the execution time is higher or equal to the next process arrival time, then it means that process have arrived at
-                     this point, so this one can either interrupt or not the process that being executed. The "doubleInterrumptions", the "displacer"
-                     and the "processRunning" variables helps to indicate the next better process that can be compared to */
-                    if (time >= processList[processRunning + 1 + doubleInterrumptions + displacer].arrivalTime) {
-                        
-                        /* If the priority of the process that is being executed, is lower than the next better process in the list, there must be an
-                         interruption */
-                        if (processList[processRunning].priority > processList[processRunning + 1 + doubleInterrumptions + displacer].priority) {
-                            
-                            /* Store the information of the process that is being executed on a new process list. The "interruptions" let us
-                             create new information about processes interrupted in the list */
-                            contextProcessList[processRunning + interrumptions] = processList[processRunning];
-                            
-                            /* Since this code is only executed when there is an interruption, we must indicate that the new process in the new list, have only executed a partial time of it's CPU burst, which is stored in the last executed parameter */
-                            contextProcessList[processRunning + interrumptions].cpuBurst = contextProcessList[processRunning + interrumptions].lastExecuted;
-                            
-                            /* It's indicated that the CPU burst now have reduced since it have been executed before "j" time unities */
-                            processList[processRunning].cpuBurst -= j;
-                            
-                            /* Create a temporal structure that stores a process
-                             in order to not lose it during the exchange */
-                            struct process temporal = processList[processRunning];
-                            
-                            /* Exchange the process which is running with which one who have interrupted */
-                            processList[processRunning] =  processList[processRunning + 1 + displacer + doubleInterrumptions];
-                            processList[processRunning + 1 + displacer + doubleInterrumptions] = temporal;
-                            
-                            doubleInterrumptions++; /* Increase this variable to indicate that an interruption have been made and the next process in the list must not be compared to */
-                            
-                            /* If the arrival time of the next process is the same, then you increase the variable "doubleInterruptions". Since
-                             the processes with the same arrival time have been ordered before, and the next process in the list could have an arrival
-                             time of just one unity of time higher than the process that is going to execute, we must validate it's information, not
-                             the process that we already know it has a higher CPU burst time */
-                            if(processList[processRunning].arrivalTime == processList[processRunning + 1 + displacer + doubleInterrumptions].arrivalTime)
-                                doubleInterrumptions++;
-                            
-                            j = 0; /* Reset this variable since a new process is going to execute */
-                            displacer = 0; /* Reset this variable for the same reason as before */
-                            interrumptions++; /* Indicate that a new interrumption has been made */
-                        }
-                        else{
-                            /* If the process that we are comparing to have been arrived but it has a higher CPU burst time, there is no reason
-                             to be stuck at it, so a displacer variable is increased. Since this can overflow the process list elements, it is
-                             used the mod function. It must be substracted the "processRunning" and the "doubleInterruptions" since there can
-                             overflow the process list too */
-                            displacer = (displacer + 1) % (numberOfProcess - (processRunning + doubleInterrumptions + 1));
-                        }
-                    }
-                    /* Since there can be a lot of interruptions of interruptions, we must return to it's initial value in order to not
-                     overflow the main process list. It is compared to the "number of process - 1" since this is the value which will overflow the
-                     process list */
-                    if (doubleInterrumptions >= numberOfProcess - 1) {
-                        doubleInterrumptions = 0; /* Reset this variable */
-                    }
-                }
-                
-                /* If the CPU burst of the process that is being executed is equals to the unities that have been executed, then this means
-                 that the process have finished it's execution time */
-                if (processList[processRunning].cpuBurst == processList[processRunning].lastExecuted) {
-                    /* We store the process information in the other list */
-                    contextProcessList[processRunning + interrumptions] = processList[processRunning];
-                    
-                    /* The last executed parameter is deleted, since this is used for the calcutions of the average time and it must be only
-                     kept during interruptions */
-                    contextProcessList[processRunning + interrumptions].lastExecuted = 0;
-                    processRunning++; /* It's indicated that a process have finished */
-                }
-            }
-            
-        break;
-            
+    process->pID = workload->pID[i];
+    process->arrivalTime = workload->arrivalTime[i];
+    process->cpuBurst = workload->cpuBurst[i];
+    process->priority = workload->priority[i];
+    process->deadline = workload->deadline[i];
+    process->cycle = workload->cycle[i];
+    process->ioTime = 0;
+    process->firstExecuted = 0;
+    process->lastExecuted = 0;
+    process->cpu = -1;
+    simulation->next++;
+    return 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenSource                                                 */
+/*                                                                       */
+/*  Purpose: Prepares a source of processes, reading the first process   */
+/*           that will arrive, and empties the queues, the CPUs, the     */
+/*           devices, the pool, the histograms and the results of the    */
+/*           simulation. The queues and the pool keep their memory from  */
+/*           the last run                                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the source, already filled    */
+/*                      with it's read function and data                 */
+/*                                                                       */
+/*            Output:   The source with the first process                */
+/*                                                                       */
+/*************************************************************************/
+static void OpenSource(struct simulation *simulation, struct processSource *source){
+    simulation->next = 0;
+    simulation->ready.size = 0;
+    simulation->ready.comparisons = simulation->ready.swaps = 0;
+    simulation->run.size = simulation->run.head = 0;
+    simulation->pool.count = simulation->pool.freeCount = 0;
+    simulation->result = (struct simulationResult){0};
+    for (int cpu = 0; cpu < simulation->machine.cpus; cpu++) {
+        struct core *core = &simulation->cores[cpu];     /* The CPU */
+        
+        core->running = core->lastPID = -1;
+        core->sliceStart = core->sliceEnd = core->busy = 0;
+        core->ready.size = 0;
+        core->ready.comparisons = core->ready.swaps = 0;
+        core->run.size = core->run.head = 0;
+        EmptyLevelQueue(&core->levels);
+        core->minVruntime = core->load = 0;
+        core->tasks = 0;
     }
+    for (int device = 0; device < simulation->machine.devices; device++) {
+        simulation->devices[device].queue.size = simulation->devices[device].queue.head = 0;
+        simulation->devices[device].serving = -1;
+        simulation->devices[device].end = 0;
+    }
+    ClearHistogram(&simulation->latencies->wait);
+    ClearHistogram(&simulation->latencies->response);
+    ClearHistogram(&simulation->latencies->turnaround);
     
-    /* Since this is the last process in the main list, we just include it in the other process list */
-    contextProcessList[processRunning + interrumptions] = processList[processRunning];
-    
-    /* The average waiting time is calculated considering the other process list that is created in the procedure. It's dimensions
-     are explicitly indicated as a parameter, and the first arrival for the inverse treatment is send to */
-    WaitTime(processRunning + interrumptions + 1, contextProcessList, firstArrival);
-    
-    /* Due to the changes that are made through this procedure, the main process list is returned to it's original state */
-    RestoreProcessList();
-    
+    source->status = source->read(source->data, &source->next);
+    simulation->start = source->status == 1 ? source->next.arrivalTime : 0;
 }
 
 /*************************************************************************/
 /*                                                                       */
-/*  Function: RoundRobin                                                 */
+/*  Function: Arrived                                                    */
 /*                                                                       */
-/*  Purpose: Generates the wait time for each of the processes using     */
-/*           the Round Robin algorithm. Furthermore, the context changes */
-/*           are printed and shown to the user                           */
+/*  Purpose: Tells if the next process of the source has arrived at a    */
+/*           given time                                                  */
 /*                                                                       */
 /*  Parameters:                                                          */
-/*            Input :   The process list which in will be computing the  */
-/*                      average wait time and the quantum                */
+/*            Input :   The source and the time                          */
 /*                                                                       */
-/*            Output:   All the process list information considering the */
-/*                      average wait time and the context changes        */
+/*            Output:   1 if it has arrived, 0 otherwise                 */
 /*                                                                       */
 /*************************************************************************/
-void RoundRobin(int quantum){
-    
-    printf(" ---------------------------\n");
-    printf("|        Round Robin        |\n");
-    printf(" ---------------------------");
-    
-    int processesCompleted = 0; /* This variable indicates which process is being executed and is used to know
-                                 how many processes have finished it's execution */
+static int Arrived(const struct processSource *source, long long time){
+    return (source->status == 1 && source->next.arrivalTime <= time);
+}
 
-    int difference = 0; /* This variable indicates if a process finishes it's execution before it's quantum expires */
-    int time = processList[0].arrivalTime; /* This variable stores all the execution time at a specific point. The arrival time
-                                            of the first process indicates at which moment the processes begin their execution */
-    
-    float averageWaitTime = 0.0; /* The variable that will store the average
-                                  waiting time */
+/*************************************************************************/
+/*                                                                       */
+/*  Function: AdmitProcess                                               */
+/*                                                                       */
+/*  Purpose: Takes the next process of the source and stores it in the   */
+/*           pool of processes that are in the system, reading the       */
+/*           process that will arrive after it                           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The source and the pool                          */
+/*                                                                       */
+/*            Output:   The slot of the process in the pool              */
+/*                                                                       */
+/*************************************************************************/
+static int AdmitProcess(struct processSource *source, struct processPool *pool){
+    int slot;                           /* Where the process is stored */
+    
+    /* Use a free slot, or a new one if there is none. The pool only grows up to the number of processes that are in the
+     system at the same time */
+    if (pool->freeCount > 0)
+        slot = pool->freeSlots[--pool->freeCount];
+    else {
+        if (pool->count == pool->capacity) {
+            int capacity = pool->capacity ? pool->capacity * 2 : INITIALPROCESSES;
+            struct process *processes = realloc(pool->processes, (size_t)capacity * sizeof(struct process));
+            int *freeSlots = realloc(pool->freeSlots, (size_t)capacity * sizeof(int));
+            
+            if (processes)
+                pool->processes = processes;
+            if (freeSlots)
+                pool->freeSlots = freeSlots;
+            if (!processes || !freeSlots) {
+                ErrorMsg("'AdmitProcess'", "Not enough memory for the processes");
+                exit(EXIT_FAILURE);
+            }
+            pool->capacity = capacity;
+        }
+        slot = pool->count++;
+    }
+    
+    pool->processes[slot] = source->next;
+    pool->processes[slot].lastExecuted = 0; /* Nothing of it's CPU burst have been executed */
+    pool->processes[slot].cpu = -1;
+    pool->processes[slot].level = 0;         /* It starts in the first level */
+    pool->processes[slot].vruntime = 0;
+    pool->processes[slot].ioTime = 0;
+    pool->processes[slot].firstExecuted = -1;          /* Not dispatched yet */
+    
+    source->status = source->read(source->data, &source->next);
+    
+    return slot;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ArrivalKey                                                 */
+/*                                                                       */
+/*  Purpose: Obtains the key of a process in the ready queue of First    */
+/*           Come First Served: it's arrival time                        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process                                      */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline int ArrivalKey(const struct process *process){
+    return process->arrivalTime;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: BurstKey                                                   */
+/*                                                                       */
+/*  Purpose: Obtains the key of a process in the ready queue of the      */
+/*           algorithms by CPU burst: the CPU burst that is left         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process                                      */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline int BurstKey(const struct process *process){
+    return process->cpuBurst - (int)process->lastExecuted;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PriorityKey                                                */
+/*                                                                       */
+/*  Purpose: Obtains the key of a process in the ready queue of the      */
+/*           algorithms by priority: it's priority                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process                                      */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline int PriorityKey(const struct process *process){
+    return process->priority;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ProcessKey                                                 */
+/*                                                                       */
+/*  Purpose: Obtains the key of a process in the ready queue: the        */
+/*           arrival time, the CPU burst that is left or the priority    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process and the key of the queue             */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static int ProcessKey(const struct process *process, int key){
+    switch (key) {
+        case ARRIVALTIME:
+            return ArrivalKey(process);
+        case CPUBURST:
+            return BurstKey(process);
+        default:
+            return PriorityKey(process);
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Burst                                                      */
+/*                                                                       */
+/*  Purpose: Obtains the length of the current CPU burst of a process,   */
+/*           which is it's whole CPU burst if it has no I/O cycles       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the process                   */
+/*                                                                       */
+/*            Output:   The length of the burst                          */
+/*                                                                       */
+/*************************************************************************/
+static int Burst(const struct simulation *simulation, const struct process *process){
+    return (process->cycle < 0 ? process->cpuBurst : simulation->workload->cycles[process->cycle]);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: HasIO                                                      */
+/*                                                                       */
+/*  Purpose: Tells if an I/O burst follows the current CPU burst of a    */
+/*           process                                                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the process                   */
+/*                                                                       */
+/*            Output:   1 if it does, 0 if the process finishes with it  */
+/*                                                                       */
+/*************************************************************************/
+static int HasIO(const struct simulation *simulation, const struct process *process){
+    return (process->cycle >= 0 && simulation->workload->cycles[process->cycle + 1] != 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Deadline                                                   */
+/*                                                                       */
+/*  Purpose: Obtains the time when a process should finish. The deadline */
+/*           of the file is that time, or the time after the arrival     */
+/*           when the deadlines of the simulation are relative           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the process                   */
+/*                                                                       */
+/*            Output:   The deadline, or LLONG_MAX if it has none        */
+/*                                                                       */
+/*************************************************************************/
+static long long Deadline(const struct simulation *simulation, const struct process *process){
+    if (process->deadline == NODEADLINE)
+        return LLONG_MAX;
+    if (simulation->deadlines == RELATIVEDEADLINES)
+        return (long long)process->arrivalTime + process->deadline;
+    
+    return process->deadline;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CountContextChange                                         */
+/*                                                                       */
+/*  Purpose: Accounts for a process that starts to be executed. It is a  */
+/*           context switch only if the CPU had another process, or none */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU and the process ID       */
+/*                                                                       */
+/*            Output:   The number of context switches of the results    */
+/*                                                                       */
+/*************************************************************************/
+static void CountContextChange(struct simulation *simulation, int cpu, int pID){
+    if (pID != simulation->cores[cpu].lastPID)
+        simulation->result.contextSwitches++;
+    simulation->cores[cpu].lastPID = pID;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ContextChange                                              */
+/*                                                                       */
+/*  Purpose: Reports a context change when a process starts to be        */
+/*           executed. It describes which process is running at a       */
+/*           particular time, which is it's first execution if it had    */
+/*           never been dispatched                                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the time and the slot   */
+/*                      of the process                                   */
+/*                                                                       */
+/*            Output:   The context change                               */
+/*                                                                       */
+/*************************************************************************/
+static void ContextChange(struct simulation *simulation, int cpu, long long time, int slot){
+    struct process *process = &simulation->pool.processes[slot];   /* The process */
+    
+    if (process->firstExecuted < 0)
+        process->firstExecuted = time;
+    CountContextChange(simulation, cpu, process->pID);
+    simulation->cores[cpu].sliceStart = time;
+    ReportDispatch(&simulation->report, time, process->pID, cpu);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: EndSlice                                                   */
+/*                                                                       */
+/*  Purpose: Adds to the trace, if there is one, the slice of time that  */
+/*           a process spent in the CPU since it's last context change,  */
+/*           unless it left the CPU before the switch was done           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the time, the process   */
+/*                      ID and why the process leaves the CPU            */
+/*                                                                       */
+/*            Output:   The trace with the slice                         */
+/*                                                                       */
+/*************************************************************************/
+static void EndSlice(struct simulation *simulation, int cpu, long long time, int pID, int reason){
+    if (simulation->trace && time > simulation->cores[cpu].sliceStart)
+        TraceSlice(simulation->trace, simulation->cores[cpu].sliceStart, time, pID, cpu, reason);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FinishProcess                                              */
+/*                                                                       */
+/*  Purpose: Accounts for a process that finished it's execution. It's   */
+/*           waiting time is the time it finished, minus it's arrival    */
+/*           time, it's CPU burst and the time it was blocked in the I/O */
+/*           devices, and it's turnaround time is the time it finished   */
+/*           minus it's arrival time. Both are added to the histograms   */
+/*           with it's response time, from it's arrival to it's first    */
+/*           execution. If it finished after it's deadline, it is a miss */
+/*           and the difference is it's lateness. The slot of the        */
+/*           process returns to the pool, and the process is reported    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the slot of the process */
+/*                      and the time                                     */
+/*                                                                       */
+/*            Output:   The results with this process                    */
+/*                                                                       */
+/*************************************************************************/
+static void FinishProcess(struct simulation *simulation, int cpu, int slot, long long time){
+    struct processPool *pool = &simulation->pool;            /* The pool */
+    struct process *process = &pool->processes[slot];   /* The process */
+    long long waitTime = time - process->arrivalTime - process->cpuBurst - process->ioTime;
+    
+    EndSlice(simulation, cpu, time, process->pID, TRACEFINISHED);
+    ReportFinish(&simulation->report, time, process->pID, waitTime);
+    
+    simulation->result.processes++;
+    simulation->result.totalWaitTime += waitTime;
+    simulation->result.totalTurnaround += time - process->arrivalTime;
+    simulation->result.span = time - simulation->start;
+    RecordTime(&simulation->latencies->wait, waitTime);
+    RecordTime(&simulation->latencies->response, process->firstExecuted - process->arrivalTime);
+    RecordTime(&simulation->latencies->turnaround, time - process->arrivalTime);
+    if (process->deadline != NODEADLINE) {
+        long long lateness = time - Deadline(simulation, process); /* Time after the deadline */
+        
+        simulation->result.deadlines++;
+        if (lateness > 0) {
+            simulation->result.deadlineMisses++;
+            simulation->result.totalLateness += lateness;
+            if (lateness > simulation->result.maxLateness)
+                simulation->result.maxLateness = lateness;
+        }
+    }
+    pool->freeSlots[pool->freeCount++] = slot;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: EndRun                                                     */
+/*                                                                       */
+/*  Purpose: Ends the run of an algorithm, obtaining the distributions   */
+/*           of the times from it's histograms and the work of all the   */
+/*           ready queues, and reporting the results                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation                                   */
+/*                                                                       */
+/*            Output:   The results, with the distributions              */
+/*                                                                       */
+/*************************************************************************/
+static void EndRun(struct simulation *simulation){
+    simulation->result.comparisons = simulation->ready.comparisons;
+    simulation->result.swaps = simulation->ready.swaps;
+    for (int cpu = 0; cpu < simulation->machine.cpus; cpu++) {
+        simulation->result.comparisons += simulation->cores[cpu].ready.comparisons;
+        simulation->result.swaps += simulation->cores[cpu].ready.swaps;
+    }
+    SummarizeHistogram(&simulation->latencies->wait, &simulation->result.wait);
+    SummarizeHistogram(&simulation->latencies->response, &simulation->result.response);
+    SummarizeHistogram(&simulation->latencies->turnaround, &simulation->result.turnaround);
+    ReportEnd(&simulation->report, &simulation->result);
+}
+
+/* A policy chooses the process that is executed by the engine for one CPU. The queue orders the processes by the key, and then
+ by process ID */
+struct selectionPolicy{
+    int (*key)(const struct process *process);    /* The lowest goes first */
+    int preemptive;   /* Can a lower key interrupt the running process? */
+};
+
+static const struct selectionPolicy firstCome = {ArrivalKey, 0};
+static const struct selectionPolicy shortestJob = {BurstKey, 0};
+static const struct selectionPolicy priorityFirst = {PriorityKey, 0};
+static const struct selectionPolicy shortestRemaining = {BurstKey, 1};
+static const struct selectionPolicy priorityPreemptive = {PriorityKey, 1};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunSingleCPU                                               */
+/*                                                                       */
+/*  Purpose: Simulates the algorithms of a selection policy over one     */
+/*           CPU. Instead of advancing the time one unity at a time,     */
+/*           the simulation jumps from one event to the next one: the    */
+/*           arrival of a process or the end of the process that is      */
+/*           being executed. The processes wait in a ready queue ordered */
+/*           by the key of the policy, and only an arrival can cause an  */
+/*           interruption, if the policy is preemptive, so the cost      */
+/*           depends on the number of processes and not on the length    */
+/*           of their CPU bursts. It is always inlined with a constant   */
+/*           policy, so every algorithm gets it's own copy with the key  */
+/*           and the preemption resolved by the compiler                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the source of the processes and  */
+/*                      the selection policy                             */
+/*                                                                       */
+/*            Output:   The context changes and the average wait time    */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void RunSingleCPU(struct simulation *simulation, struct processSource *source,
+                                                              const struct selectionPolicy *policy){
+    
+    struct readyQueue *ready = &simulation->ready; /* The processes that have arrived and are waiting to be executed */
+    
+    struct processPool *pool = &simulation->pool; /* The processes that are in the system */
+    
+    int processRunning = -1; /* The slot of the process that is being executed, or -1 if the CPU is idle */
+    
+    long long time = 0; /* This variable stores all the execution time at a specific point */
+    
+    long long finish; /* Time at which the process that is being executed would finish */
+    
+    OpenSource(simulation, source);
+    
+    if (source->status == 1)
+        time = source->next.arrivalTime; /* The simulation starts when the first process arrives */
+    
+    while (source->status == 1 || ready->size > 0 || processRunning != -1) {
+        simulation->result.events++;
+        
+        /* Every process that have arrived at this point is included in the ready queue. The queue keeps at top the process with the
+         lowest key, and the lowest process ID in case of a tie */
+        while (Arrived(source, time)) {
+            int slot = AdmitProcess(source, pool);
+            PushReadyQueue(ready, policy->key(&pool->processes[slot]), pool->processes[slot].pID, slot);
+        }
+        
+        if (processRunning == -1) {
+            /* If no process is waiting, the CPU is idle until the next arrival */
+            if (ready->size == 0) {
+                if (source->status != 1)
+                    break;
+                time = source->next.arrivalTime;
+                continue;
+            }
+            
+            /* The best process in the queue starts it's execution, which is a new context change */
+            processRunning = PopReadyQueue(ready).index;
+            ContextChange(simulation, 0, time, processRunning);
+        }
+        
+        finish = time + pool->processes[processRunning].cpuBurst - pool->processes[processRunning].lastExecuted;
+        
+        /* If another process arrives before the process that is being executed finishes, it is the only point where an
+         interruption can happen. Without preemption the process always finishes */
+        if (policy->preemptive && source->status == 1 && source->next.arrivalTime < finish) {
+            
+            /* The process that is being executed advances until the arrival */
+            pool->processes[processRunning].lastExecuted += source->next.arrivalTime - time;
+            time = source->next.arrivalTime;
+            
+            /* Include the processes that arrive at this time in the ready queue */
+            while (Arrived(source, time)) {
+                int slot = AdmitProcess(source, pool);
+                PushReadyQueue(ready, policy->key(&pool->processes[slot]), pool->processes[slot].pID, slot);
+            }
+            
+            /* There is an interruption only if the best process in the queue has a lower key than the process that is being
+             executed: a lower CPU burst than the CPU burst that is left, or a higher priority */
+            if (ready->size > 0 && ready->entries[0].key < policy->key(&pool->processes[processRunning])) {
+                
+                /* The interrupted process returns to the ready queue with it's key, the CPU burst that is left if it is the key */
+                PushReadyQueue(ready, policy->key(&pool->processes[processRunning]), pool->processes[processRunning].pID,
+                               processRunning);
+                EndSlice(simulation, 0, time, pool->processes[processRunning].pID, TRACEPREEMPTED);
+                processRunning = -1;
+            }
+        }
+        else {
+            /* The process finishes it's execution */
+            time = finish;
+            FinishProcess(simulation, 0, processRunning, time);
+            processRunning = -1;
+        }
+    }
+    
+    EndRun(simulation);
+}
+
+/* Every algorithm for one CPU is an engine with it's policy */
+#define SINGLECPUENGINE(name, policy)                                                     \
+    static void name(struct simulation *simulation, struct processSource *source){        \
+        RunSingleCPU(simulation, source, &policy);                                        \
+    }
+
+SINGLECPUENGINE(RunFirstCome, firstCome)
+SINGLECPUENGINE(RunShortestJob, shortestJob)
+SINGLECPUENGINE(RunPriorityFirst, priorityFirst)
+SINGLECPUENGINE(RunShortestRemaining, shortestRemaining)
+SINGLECPUENGINE(RunPriorityPreemptive, priorityPreemptive)
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunRoundRobin                                              */
+/*                                                                       */
+/*  Purpose: Simulates the Round Robin algorithm. The processes wait in  */
+/*           a circular FIFO queue that holds their slot in the pool, so */
+/*           every quantum costs O(1)                                    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the source of the processes and  */
+/*                      the quantum                                      */
+/*                                                                       */
+/*            Output:   The context changes and the average wait time    */
+/*                                                                       */
+/*************************************************************************/
+static void RunRoundRobin(struct simulation *simulation, struct processSource *source, int quantum){
+    
+    struct runQueue *queue = &simulation->run; /* The processes that have arrived and are waiting for their quantum */
+    
+    struct processPool *pool = &simulation->pool; /* The processes that are in the system */
+    
+    int processRunning; /* The slot of the process that is being executed */
+    
+    long long slice; /* The time that the process is executed, the quantum or less if it finishes before */
+    
+    long long time = 0; /* This variable stores all the execution time at a specific point */
+    
+    OpenSource(simulation, source);
+    
+     /* Repeat the procedure until there are no more processes */
+    while (source->status == 1 || queue->size > 0) {
+        simulation->result.events++;
+        
+        /* If no process is waiting, the CPU is idle until the next arrival */
+        if (queue->size == 0 && time < source->next.arrivalTime)
+            time = source->next.arrivalTime;
+        
+        /* The processes that have arrived at this point are included at the end of the queue */
+        while (Arrived(source, time))
+            PushRunQueue(queue, AdmitProcess(source, pool));
+        
+        /* The source may have failed while the queue was empty */
+        if (queue->size == 0)
+            break;
+        
+        processRunning = PopRunQueue(queue);
+        
+        ContextChange(simulation, 0, time, processRunning);
+        
+        /* The process is executed for a quantum, or less if it's CPU burst left is lower */
+        slice = pool->processes[processRunning].cpuBurst - pool->processes[processRunning].lastExecuted;
+        if (slice > quantum)
+            slice = quantum;
+        time += slice;
+        pool->processes[processRunning].lastExecuted += slice;
+        
+        /* The processes that arrived during the quantum go to the queue before the process that was executed */
+        while (Arrived(source, time))
+            PushRunQueue(queue, AdmitProcess(source, pool));
+        
+        /* If the process have not finished yet, it's sent back to the last position in the queue */
+        if (pool->processes[processRunning].lastExecuted < pool->processes[processRunning].cpuBurst) {
+            PushRunQueue(queue, processRunning);
+            EndSlice(simulation, 0, time, pool->processes[processRunning].pID, TRACEEXPIRED);
+        }
+        else {
+            FinishProcess(simulation, 0, processRunning, time); /* It's indicated that a process finished it's execution procedure */
+        }
+    }
+    
+    EndRun(simulation);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: QueueOf                                                    */
+/*                                                                       */
+/*  Purpose: Finds the CPU whose queues hold the processes waiting for   */
+/*           another CPU. With a global queue, all the CPUs use the      */
+/*           queues of the first one                                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the CPU                       */
+/*                                                                       */
+/*            Output:   The CPU with the queues                          */
+/*                                                                       */
+/*************************************************************************/
+static struct core *QueueOf(struct simulation *simulation, int cpu){
+    return &simulation->cores[simulation->machine.policy == GLOBALQUEUE ? 0 : cpu];
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Waiting                                                    */
+/*                                                                       */
+/*  Purpose: Counts the processes waiting in the queues of a CPU         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The CPU and the key of the queue, FIFO, LEVELS   */
+/*                      or VRUNTIME                                      */
+/*                                                                       */
+/*            Output:   The number of processes                          */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) int Waiting(const struct core *queue, int key){
+    switch (key) {
+        case FIFO:
+            return queue->run.size;
+        case LEVELS:
+            return queue->levels.size;
+        default:
+            return queue->ready.size;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: TopKey                                                     */
+/*                                                                       */
+/*  Purpose: Obtains the key of the process that goes first in the       */
+/*           queues of a CPU, which must not be empty. For the           */
+/*           Multilevel Feedback Queue, it is the level                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The CPU and the key of the queue, or LEVELS      */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) long long TopKey(const struct core *queue, int key){
+    return (key == LEVELS ? TopLevel(&queue->levels) : queue->ready.entries[0].key);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Enqueue                                                    */
+/*                                                                       */
+/*  Purpose: Includes a process in the queues of a CPU                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the slot of the process */
+/*                      and the key of the queue, FIFO, LEVELS or        */
+/*                      VRUNTIME. The key CPUBURST is the part of the    */
+/*                      current CPU burst that is left                   */
+/*                                                                       */
+/*            Output:   The queue with the process                       */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void Enqueue(const struct simulation *simulation, struct core *queue, int slot, int key){
+    const struct processPool *pool = &simulation->pool;     /* The pool */
+    
+    switch (key) {
+        case FIFO:
+            PushRunQueue(&queue->run, slot);
+            break;
+        case LEVELS:
+            PushLevelQueue(&queue->levels, pool->processes[slot].level, slot);
+            break;
+        case VRUNTIME:
+            PushReadyQueue(&queue->ready, pool->processes[slot].vruntime, pool->processes[slot].pID, slot);
+            break;
+        case DEADLINE:
+            PushReadyQueue(&queue->ready, Deadline(simulation, &pool->processes[slot]), pool->processes[slot].pID, slot);
+            break;
+        case CPUBURST:
+            PushReadyQueue(&queue->ready, Burst(simulation, &pool->processes[slot]) - pool->processes[slot].lastExecuted,
+                           pool->processes[slot].pID, slot);
+            break;
+        default:
+            PushReadyQueue(&queue->ready, ProcessKey(&pool->processes[slot], key), pool->processes[slot].pID, slot);
+            break;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Dequeue                                                    */
+/*                                                                       */
+/*  Purpose: Removes the process that goes first from the queues of a    */
+/*           CPU, which must not be empty                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The CPU and the key of the queue, FIFO, LEVELS   */
+/*                      or VRUNTIME                                      */
+/*                                                                       */
+/*            Output:   The slot of the process                          */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) int Dequeue(struct core *queue, int key){
+    switch (key) {
+        case FIFO:
+            return PopRunQueue(&queue->run);
+        case LEVELS:
+            return PopLevel(&queue->levels, TopLevel(&queue->levels));
+        default:
+            return PopReadyQueue(&queue->ready).index;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: LevelQuantum                                               */
+/*                                                                       */
+/*  Purpose: Obtains the quantum of a level of the Multilevel Feedback   */
+/*           Queue. If it was not given, it is the quantum of the        */
+/*           workload doubled at every level                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The levels, the level and the quantum            */
+/*                                                                       */
+/*            Output:   The quantum of the level, at least 1             */
+/*                                                                       */
+/*************************************************************************/
+static int LevelQuantum(const struct feedback *feedback, int level, int quantum){
+    long long slice = quantum > 1 ? quantum : 1;  /* The quantum doubled */
+    
+    if (feedback->quanta[level] > 0)
+        return feedback->quanta[level];
+    
+    for (int i = 0; i < level && slice < INT_MAX; i++)
+        slice *= 2;
+    
+    return (slice < INT_MAX ? (int)slice : INT_MAX);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: BoostPeriod                                                */
+/*                                                                       */
+/*  Purpose: Obtains the time between the boosts of the Multilevel       */
+/*           Feedback Queue, which move every process to the first level */
+/*           so the long processes do not starve                         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The levels and the quantum                       */
+/*                                                                       */
+/*            Output:   The time, or 0 if there are no boosts            */
+/*                                                                       */
+/*************************************************************************/
+static long long BoostPeriod(const struct feedback *feedback, int quantum){
+    if (feedback->boost >= 0)
+        return feedback->boost;
+    
+    return (long long)BOOSTQUANTA * LevelQuantum(feedback, feedback->levels - 1, quantum);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Boost                                                      */
+/*                                                                       */
+/*  Purpose: Moves every process of the Multilevel Feedback Queue to the */
+/*           first level. The processes waiting keep their order, level  */
+/*           after level, the ones being executed finish their slice in  */
+/*           the first level, and the ones in the I/O devices return to  */
+/*           it                                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation                                   */
+/*                                                                       */
+/*            Output:   The processes in the first level                 */
+/*                                                                       */
+/*************************************************************************/
+static void Boost(struct simulation *simulation){
+    struct process *processes = simulation->pool.processes; /* The processes */
+    
+    for (int cpu = 0; cpu < simulation->machine.cpus; cpu++) {
+        struct levelQueue *queue = &simulation->cores[cpu].levels; /* It's levels */
+        
+        for (int level = 1; level < MAXLEVELS && queue->nonEmpty >> 1; level++)
+            while (queue->levels[level].size > 0) {
+                int slot = PopLevel(queue, level);       /* The process */
+                processes[slot].level = 0;
+                PushLevelQueue(queue, 0, slot);
+            }
+        if (simulation->cores[cpu].running != -1)
+            processes[simulation->cores[cpu].running].level = 0;
+    }
+    
+    for (int device = 0; device < simulation->machine.devices; device++) {
+        const struct runQueue *queue = &simulation->devices[device].queue; /* It's requests */
+        
+        for (int i = 0; i < queue->size; i++)
+            processes[queue->slots[(queue->head + i) & (queue->capacity - 1)]].level = 0;
+        if (simulation->devices[device].serving != -1)
+            processes[simulation->devices[device].serving].level = 0;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Weight                                                     */
+/*                                                                       */
+/*  Purpose: Obtains the weight of a process in the Completely Fair      */
+/*           Scheduler. It's priority is used as a nice value, from -20  */
+/*           to 19, and the CPU is shared in proportion to the weights   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process                                      */
+/*                                                                       */
+/*            Output:   The weight                                       */
+/*                                                                       */
+/*************************************************************************/
+static int Weight(const struct process *process){
+    int nice = process->priority;                  /* It's nice value */
+    
+    if (nice < MINNICE)
+        nice = MINNICE;
+    else if (nice > MAXNICE)
+        nice = MAXNICE;
+    
+    return weights[nice - MINNICE];
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: JoinQueue                                                  */
+/*                                                                       */
+/*  Purpose: Adds the weight of a process to the queues of a CPU, where  */
+/*           it stays while it waits or is executed                      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The CPU with the queues and the process          */
+/*                                                                       */
+/*            Output:   The load of the queues                           */
+/*                                                                       */
+/*************************************************************************/
+static void JoinQueue(struct core *queue, const struct process *process){
+    queue->load += Weight(process);
+    queue->tasks++;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: LeaveQueue                                                 */
+/*                                                                       */
+/*  Purpose: Removes the weight of a process from the queues of a CPU,   */
+/*           because it finished or another CPU stole it                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The CPU with the queues and the process          */
+/*                                                                       */
+/*            Output:   The load of the queues                           */
+/*                                                                       */
+/*************************************************************************/
+static void LeaveQueue(struct core *queue, const struct process *process){
+    queue->load -= Weight(process);
+    queue->tasks--;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Charge                                                     */
+/*                                                                       */
+/*  Purpose: Adds the time a process was executed to it's virtual        */
+/*           runtime, which grows slower the higher it's weight          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The process and the time it was executed         */
+/*                                                                       */
+/*            Output:   The virtual runtime of the process               */
+/*                                                                       */
+/*************************************************************************/
+static void Charge(struct process *process, long long executed){
+    process->vruntime += executed * NICE0WEIGHT * VRUNTIMEUNIT / Weight(process);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FairSlice                                                  */
+/*                                                                       */
+/*  Purpose: Obtains the slice of a process in the Completely Fair       */
+/*           Scheduler. Every process of the queues should be executed   */
+/*           once within the target latency, which is stretched to a     */
+/*           minimum granularity per process when there are too many,   */
+/*           and the period is shared in proportion to the weights. A    */
+/*           global queue shares the period of all it's CPUs             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the process and the     */
+/*                      quantum of the workload                          */
+/*                                                                       */
+/*            Output:   The slice, between the granularity and the       */
+/*                      period                                           */
+/*                                                                       */
+/*************************************************************************/
+static long long FairSlice(struct simulation *simulation, int cpu, const struct process *process, int quantum){
+    const struct core *queue = QueueOf(simulation, cpu);    /* It's queues */
+    int servers = simulation->machine.policy == GLOBALQUEUE ? simulation->machine.cpus : 1; /* CPUs of the queues */
+    long long granularity = simulation->fairness.granularity > 0 ? simulation->fairness.granularity : (quantum > 1 ? quantum : 1);
+    long long period = simulation->fairness.latency > 0 ? simulation->fairness.latency : LATENCYGRANULES * granularity;
+    long long slice;                                        /* It's share */
+    
+    if ((queue->tasks + servers - 1) / servers * granularity > period)
+        period = (queue->tasks + servers - 1) / servers * granularity;
+    
+    slice = (long long)((double)period * Weight(process) * servers / queue->load);
+    if (slice > period)
+        slice = period;
+    
+    return (slice > granularity ? slice : granularity);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PlaceProcess                                               */
+/*                                                                       */
+/*  Purpose: Chooses the CPU that gets a process that arrives. With a    */
+/*           global queue it is always the first one, and with work      */
+/*           stealing it is the CPU with the fewest processes, counting  */
+/*           the one it is executing                                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation and the key of the queues         */
+/*                                                                       */
+/*            Output:   The CPU                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) int PlaceProcess(struct simulation *simulation, int key){
+    int best = 0, bestLoad = INT_MAX;        /* The CPU with least work */
+    
+    if (simulation->machine.policy == GLOBALQUEUE)
+        return 0;
+    
+    for (int cpu = 0; cpu < simulation->machine.cpus && bestLoad > 0; cpu++) {
+        int load = Waiting(&simulation->cores[cpu], key) + (simulation->cores[cpu].running != -1);
+        if (load < bestLoad) {
+            best = cpu;
+            bestLoad = load;
+        }
+    }
+    
+    return best;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: TakeProcess                                                */
+/*                                                                       */
+/*  Purpose: Takes the next process for an idle CPU from it's queue. If  */
+/*           it is empty and the policy is work stealing, the process is */
+/*           taken from the CPU with the most processes waiting. For the */
+/*           Completely Fair Scheduler, the process moves it's weight    */
+/*           and keeps it's distance to the virtual runtime of the queue */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU and the key of the queues */
+/*                                                                       */
+/*            Output:   The slot of the process, or -1 if there is none  */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) int TakeProcess(struct simulation *simulation, int cpu, int key){
+    int victim = -1, most = 0;          /* The CPU with the most waiting */
+    int slot;                                           /* The process */
+    
+    if (Waiting(QueueOf(simulation, cpu), key) > 0)
+        return Dequeue(QueueOf(simulation, cpu), key);
+    
+    if (simulation->machine.policy == WORKSTEALING)
+        for (int other = 0; other < simulation->machine.cpus; other++)
+            if (Waiting(&simulation->cores[other], key) > most) {
+                victim = other;
+                most = Waiting(&simulation->cores[other], key);
+            }
+    
+    if (victim == -1)
+        return (-1);
+    
+    slot = Dequeue(&simulation->cores[victim], key);
+    if (key == VRUNTIME) {
+        struct process *process = &simulation->pool.processes[slot]; /* The process */
+        process->vruntime += simulation->cores[cpu].minVruntime - simulation->cores[victim].minVruntime;
+        LeaveQueue(&simulation->cores[victim], process);
+        JoinQueue(&simulation->cores[cpu], process);
+    }
+    
+    return slot;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Dispatch                                                   */
+/*                                                                       */
+/*  Purpose: Starts the execution of a process in a CPU, until it        */
+/*           finishes or, for Round Robin and the Multilevel Feedback    */
+/*           Queue, until it spends the quantum of it's queue, or it's   */
+/*           fair slice for the Completely Fair Scheduler. If it was     */
+/*           executed by another CPU before, it is a migration. The      */
+/*           process that starts is the one with the lowest virtual      */
+/*           runtime, which becomes the one of the queue. The cost of    */
+/*           the context switch, and of the migration, is spent by the   */
+/*           CPU before the process is executed                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the slot of the         */
+/*                      process, the time, the key of the queues and the */
+/*                      quantum                                          */
+/*                                                                       */
+/*            Output:   The CPU with the process                         */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void Dispatch(struct simulation *simulation, int cpu, int slot, long long time, int key, int quantum){
+    struct process *process = &simulation->pool.processes[slot]; /* The process */
+    struct core *core = &simulation->cores[cpu];                  /* The CPU */
+    long long left = Burst(simulation, process) - process->lastExecuted; /* CPU burst left */
+    long long slice = 0;        /* The longest it can keep the CPU, or 0 */
+    long long overhead = 0;           /* Time spent on the context switch */
+    
+    if (key == FIFO)
+        slice = quantum;
+    else if (key == LEVELS)
+        slice = LevelQuantum(&simulation->feedback, process->level, quantum);
+    else if (key == VRUNTIME) {
+        slice = FairSlice(simulation, cpu, process, quantum);
+        if (process->vruntime > QueueOf(simulation, cpu)->minVruntime)
+            QueueOf(simulation, cpu)->minVruntime = process->vruntime;
+    }
+    
+    if (process->cpu != -1 && process->cpu != cpu) {
+        simulation->result.migrations++;
+        overhead += simulation->costs.migration;
+    }
+    process->cpu = cpu;
+    if (process->pID != core->lastPID)
+        overhead += simulation->costs.context;
+    simulation->result.overhead += overhead;
+    
+    core->running = slot;
+    ContextChange(simulation, cpu, time + overhead, slot);
+    core->sliceEnd = core->sliceStart + (slice > 0 && left > slice ? slice : left);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StopProcess                                                */
+/*                                                                       */
+/*  Purpose: Takes the process out of a CPU, accounting for the time it  */
+/*           was executed. If the context switch was not done yet, the   */
+/*           process was not executed and the switch is cut short        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU and the time             */
+/*                                                                       */
+/*            Output:   The slot of the process, and the CPU is idle     */
+/*                                                                       */
+/*************************************************************************/
+static int StopProcess(struct simulation *simulation, int cpu, long long time){
+    struct core *core = &simulation->cores[cpu];                  /* The CPU */
+    int slot = core->running;                             /* The process */
+    
+    if (time < core->sliceStart) {
+        simulation->result.overhead -= core->sliceStart - time;
+        core->sliceStart = time;
+    }
+    core->busy += time - core->sliceStart;
+    simulation->pool.processes[slot].lastExecuted += time - core->sliceStart;
+    core->running = -1;
+    
+    return slot;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunningKey                                                 */
+/*                                                                       */
+/*  Purpose: Obtains the key of the process that a CPU is executing, at  */
+/*           a given time, to compare it with the queues                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the time and the key    */
+/*                                                                       */
+/*            Output:   The key                                          */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) long long RunningKey(const struct simulation *simulation, int cpu, long long time, int key){
+    const struct core *core = &simulation->cores[cpu];            /* The CPU */
+    const struct process *process = &simulation->pool.processes[core->running]; /* The process */
+    
+    if (key == CPUBURST)
+        return (Burst(simulation, process) - process->lastExecuted - (time > core->sliceStart ? time - core->sliceStart : 0));
+    if (key == LEVELS)
+        return process->level;
+    if (key == DEADLINE)
+        return Deadline(simulation, process);
+    
+    return ProcessKey(process, key);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Interrupt                                                  */
+/*                                                                       */
+/*  Purpose: Replaces the process of a CPU with the best one of a queue. */
+/*           The interrupted process returns to the queue with the CPU   */
+/*           burst that is left                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU, the queue, the time,    */
+/*                      the key and the quantum                          */
+/*                                                                       */
+/*            Output:   The CPU with the new process                     */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void Interrupt(struct simulation *simulation, int cpu, struct core *queue, long long time, int key, int quantum){
+    int slot = StopProcess(simulation, cpu, time);       /* The process */
+    
+    EndSlice(simulation, cpu, time, simulation->pool.processes[slot].pID, TRACEPREEMPTED);
+    Enqueue(simulation, queue, slot, key);
+    Dispatch(simulation, cpu, Dequeue(queue, key), time, key, quantum);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Preempt                                                    */
+/*                                                                       */
+/*  Purpose: Interrupts the processes that are worse than a process      */
+/*           waiting for their CPU, because it has a lower CPU burst     */
+/*           left, a higher priority, a lower level of the Multilevel    */
+/*           Feedback Queue or an earlier deadline. With work stealing,  */
+/*           every CPU only looks at it's own queue. With a global       */
+/*           queue, the best process waiting replaces the worst one      */
+/*           being executed, the one with the highest key and process    */
+/*           ID, until no process waiting is better                      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the time, the key and the        */
+/*                      quantum                                          */
+/*                                                                       */
+/*            Output:   The CPUs with the new processes                  */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void Preempt(struct simulation *simulation, long long time, int key, int quantum){
+    struct core *cores = simulation->cores;                  /* The CPUs */
+    const struct process *processes = simulation->pool.processes; /* The processes */
+    int cpus = simulation->machine.cpus;            /* Number of CPUs */
     
-    CopyProcessList(); /* Since the main process list it's going to change, it's created a copy of it */
+    if (simulation->machine.policy == WORKSTEALING) {
+        for (int cpu = 0; cpu < cpus; cpu++)
+            if (cores[cpu].running != -1 && Waiting(&cores[cpu], key) > 0 &&
+                TopKey(&cores[cpu], key) < RunningKey(simulation, cpu, time, key))
+                Interrupt(simulation, cpu, &cores[cpu], time, key, quantum);
+        return;
+    }
     
-     /* Repeat the procedure until the procesess completed are equal to the number of processes in the list */
-    while (processesCompleted < numberOfProcess) {
-        /* Print the context changes */
-        printf("\n|        t    =   %2d        |\n", time);
-        /* This indicates which process is running at a specific time */
-        printf("|        Process: %2d        |\n", processList[0].pID);
-        printf(" ---------------------------");
+    while (Waiting(&cores[0], key) > 0) {
+        int victim = -1;                   /* The CPU with the worst process */
+        long long worst = 0;                    /* The key of it's process */
         
-        /* The CPU burst less the quantum is stored */
-        difference = processList[0].cpuBurst - quantum;
-        /* If the difference is positive, that means that the process have not finished yet */
-        if (difference > 0) {
-            time += quantum; /* The quantum it's added to the total execution time */
-            processList[0].cpuBurst = difference /* The CPU burst now is less, since have executed an specific quantum */;
-            /* It is found in the copy of the process list the process that have been executed, in order to indicate that */
-            for (int i = 0; i < numberOfProcess; i++) {
-                if (processList[0].pID == processListCopy[i].pID) {
-                    processListCopy[i].lastExecuted++; /* Increase by one the last execution */
-                }
+        for (int cpu = 0; cpu < cpus; cpu++) {
+            int running = cores[cpu].running;        /* It's process */
+            if (running == -1)
+                continue;
+            if (victim == -1 || RunningKey(simulation, cpu, time, key) > worst ||
+                (RunningKey(simulation, cpu, time, key) == worst && processes[running].pID > processes[cores[victim].running].pID)) {
+                victim = cpu;
+                worst = RunningKey(simulation, cpu, time, key);
             }
-            
-            /* Send the process that have been executed to the last position in the queue. It is indicated that this must be done
-             considering the process that are already completed. This in order to not include garbage that are at the last positions
-             in the list */
-            for (int j = 1; j < numberOfProcess - processesCompleted; j++) {
-                if (time >= processList[j].arrivalTime) {
-                    
-                    /* Create a temporal structure that stores a process
-                     in order to not lose it during the exchange */
-                    struct process temporal = processList[j - 1];
-                    /* It is denoted a "j - 1" since the process which the exchange it is going to be done, is at the previous position */
-                    processList[j - 1] =  processList[j];
-                    processList[j] = temporal;
+        }
+        
+        if (victim == -1 || TopKey(&cores[0], key) >= worst)
+            break;
+        Interrupt(simulation, victim, &cores[0], time, key, quantum);
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StartDevice                                                */
+/*                                                                       */
+/*  Purpose: Starts the first request of the queue of an I/O device, if  */
+/*           the device is idle                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the device and the time          */
+/*                                                                       */
+/*            Output:   The device serving the request                   */
+/*                                                                       */
+/*************************************************************************/
+static void StartDevice(struct simulation *simulation, struct device *device, long long time){
+    const struct process *process;                /* The process served */
+    
+    if (device->serving != -1 || device->queue.size == 0)
+        return;
+    
+    device->serving = PopRunQueue(&device->queue);
+    process = &simulation->pool.processes[device->serving];
+    device->end = time + simulation->workload->cycles[process->cycle - 1];
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Block                                                      */
+/*                                                                       */
+/*  Purpose: Sends a process that completed a CPU burst to the queue of  */
+/*           it's I/O device, chosen by it's process ID, where it waits  */
+/*           for it's I/O burst before the next CPU burst                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the CPU that executed it, the    */
+/*                      slot of the process and the time                 */
+/*                                                                       */
+/*            Output:   The device with the process                      */
+/*                                                                       */
+/*************************************************************************/
+static void Block(struct simulation *simulation, int cpu, int slot, long long time){
+    struct process *process = &simulation->pool.processes[slot]; /* The process */
+    struct device *device = &simulation->devices[(unsigned int)process->pID % (unsigned int)simulation->machine.devices];
+    
+    EndSlice(simulation, cpu, time, process->pID, TRACEBLOCKED);
+    process->cycle += 2;
+    process->lastExecuted = 0;
+    process->ioTime -= time;
+    simulation->result.ioBursts++;
+    
+    PushRunQueue(&device->queue, slot);
+    StartDevice(simulation, device, time);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Wake                                                       */
+/*                                                                       */
+/*  Purpose: Returns a process that completed it's I/O burst to the      */
+/*           queues of the CPUs, as if it arrived again. First Come      */
+/*           First Served orders it by the time it woke, the Multilevel  */
+/*           Feedback Queue keeps it's level, and the Completely Fair    */
+/*           Scheduler does not let it fall behind the virtual runtime   */
+/*           of it's queue                                               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the slot of the process, the     */
+/*                      time and the key of the queues                   */
+/*                                                                       */
+/*            Output:   The queues with the process                      */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void Wake(struct simulation *simulation, int slot, long long time, int key){
+    struct process *process = &simulation->pool.processes[slot]; /* The process */
+    struct core *queue = QueueOf(simulation, PlaceProcess(simulation, key)); /* Where it waits */
+    
+    process->ioTime += time;
+    if (key == VRUNTIME) {
+        if (process->vruntime < queue->minVruntime)
+            process->vruntime = queue->minVruntime;
+        JoinQueue(queue, process);
+    }
+    
+    if (key == ARRIVALTIME)
+        PushReadyQueue(&queue->ready, time, process->pID, slot);
+    else
+        Enqueue(simulation, queue, slot, key);
+}
+
+/* A queue policy orders the queues of the engine for many CPUs by it's key, FIFO, LEVELS, VRUNTIME or a field of the
+ processes, and the preemptive ones interrupt the processes that are worse than one waiting */
+struct queuePolicy{
+    int key;                                  /* The order of the queues */
+    int preemptive;   /* Can a better process interrupt a running one? */
+};
+
+static const struct queuePolicy firstComeQueues = {ARRIVALTIME, 0};
+static const struct queuePolicy shortestJobQueues = {CPUBURST, 0};
+static const struct queuePolicy priorityFirstQueues = {PRIORITY, 0};
+static const struct queuePolicy shortestRemainingQueues = {CPUBURST, 1};
+static const struct queuePolicy priorityPreemptiveQueues = {PRIORITY, 1};
+static const struct queuePolicy roundRobinQueues = {FIFO, 0};
+static const struct queuePolicy feedbackQueues = {LEVELS, 1};
+static const struct queuePolicy fairQueues = {VRUNTIME, 0};
+static const struct queuePolicy deadlineQueues = {DEADLINE, 1};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunMultiCPU                                                */
+/*                                                                       */
+/*  Purpose: Simulates any of the algorithms over many CPUs. The         */
+/*           simulation jumps from one event to the next one: the        */
+/*           arrival of a process, or the end of the slice of a CPU      */
+/*           because it's process finishes or spends it's quantum. At    */
+/*           every event, the processes that finish leave the CPUs, the  */
+/*           ones that arrive are queued, the ones that spent their      */
+/*           quantum are queued after them (one level lower in the       */
+/*           Multilevel Feedback Queue), the idle CPUs take the best     */
+/*           process waiting (or steal one), and the preemptive          */
+/*           algorithms interrupt the processes that are worse than one  */
+/*           waiting. The boosts of the Multilevel Feedback Queue are    */
+/*           events too, but only while there are processes. The         */
+/*           Completely Fair Scheduler gives the processes that arrive   */
+/*           the virtual runtime of their queue and charges the slices   */
+/*           that end, and it's processes are not interrupted before     */
+/*           their slice ends. The processes that complete a CPU burst   */
+/*           followed by an I/O burst block in their device instead of   */
+/*           finishing, and the ends of the I/O bursts are events that   */
+/*           queue them again before the processes that spent their      */
+/*           quantum. Each event costs O(CPUs + devices) besides the     */
+/*           queues. Like the engine for one CPU, it is always inlined   */
+/*           with a constant policy, so the key of the queues and the    */
+/*           preemption are resolved by the compiler in every copy       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the source of the processes, the */
+/*                      queue policy and the quantum for Round Robin,    */
+/*                      the Multilevel Feedback Queue and the Completely */
+/*                      Fair Scheduler                                   */
+/*                                                                       */
+/*            Output:   The context changes, the average wait time, the  */
+/*                      time every CPU was busy and the I/O bursts       */
+/*                                                                       */
+/*************************************************************************/
+static inline __attribute__((always_inline)) void RunMultiCPU(struct simulation *simulation, struct processSource *source,
+                                                             const struct queuePolicy *policy, int quantum){
+    
+    struct processPool *pool = &simulation->pool; /* The processes that are in the system */
+    
+    struct core *cores = simulation->cores; /* The CPUs */
+    
+    struct device *devices = simulation->devices; /* The I/O devices */
+    
+    int cpus = simulation->machine.cpus, numberOfDevices = simulation->machine.devices; /* Number of CPUs and devices */
+    
+    int key = policy->key; /* The order of the queues */
+    
+    int running = 0, waiting = 0; /* Processes being executed and waiting in the queues */
+    
+    long long time = 0; /* The time of the event */
+    
+    long long boost = 0, nextBoost = LLONG_MAX; /* Time between the boosts of the Multilevel Feedback Queue, and the next one */
+    
+    if (key == LEVELS) {
+        boost = BoostPeriod(&simulation->feedback, quantum);
+        if (boost > 0)
+            nextBoost = boost;
+    }
+    
+    OpenSource(simulation, source);
+    
+    if (source->status == 1)
+        time = source->next.arrivalTime; /* The simulation starts when the first process arrives */
+    
+    for (;;) {
+        long long next = LLONG_MAX; /* The time of the next event */
+        
+        simulation->result.events++;
+        
+        /* The processes that complete their CPU burst finish, or block for their next I/O burst */
+        for (int cpu = 0; cpu < cpus; cpu++)
+            if (cores[cpu].running != -1 && cores[cpu].sliceEnd == time &&
+                pool->processes[cores[cpu].running].lastExecuted + time - cores[cpu].sliceStart ==
+                Burst(simulation, &pool->processes[cores[cpu].running])) {
+                int slot = StopProcess(simulation, cpu, time);
+                int blocks = HasIO(simulation, &pool->processes[slot]); /* Does an I/O burst follow? */
+                if (key == VRUNTIME) {
+                    if (blocks)
+                        Charge(&pool->processes[slot], time - cores[cpu].sliceStart);
+                    LeaveQueue(QueueOf(simulation, cpu), &pool->processes[slot]);
                 }
+                if (blocks)
+                    Block(simulation, cpu, slot, time);
+                else
+                    FinishProcess(simulation, cpu, slot, time);
+                running--;
+            }
+        
+        /* Every process that have arrived at this point is queued */
+        while (Arrived(source, time)) {
+            int slot = AdmitProcess(source, pool);
+            struct core *queue = QueueOf(simulation, PlaceProcess(simulation, key)); /* Where it waits */
+            if (key == VRUNTIME) {
+                pool->processes[slot].vruntime = queue->minVruntime;
+                JoinQueue(queue, &pool->processes[slot]);
             }
+            Enqueue(simulation, queue, slot, key);
+            waiting++;
         }
-        /* If the difference is negative or zero, then the process already finished it's execution */
-        else {
-            /* It is found in the copy of the process list the process that have been executed, in order to indicate it's first
-             execution time */
-                for (int i = 0; i < numberOfProcess; i++) {
-                if (processList[0].pID == processListCopy[i].pID) {
-                    processListCopy[i].firstExecuted = time;
-                }
+        
+        /* The processes that complete their I/O burst are queued, and their devices serve the next request */
+        for (int device = 0; device < numberOfDevices; device++)
+            if (devices[device].serving != -1 && devices[device].end == time) {
+                Wake(simulation, devices[device].serving, time, key);
+                devices[device].serving = -1;
+                StartDevice(simulation, &devices[device], time);
+                waiting++;
+            }
+        
+        /* The processes that spent their quantum go back to the queue of their CPU, after the ones that arrived */
+        for (int cpu = 0; cpu < cpus; cpu++)
+            if (cores[cpu].running != -1 && cores[cpu].sliceEnd == time) {
+                int slot = StopProcess(simulation, cpu, time);
+                EndSlice(simulation, cpu, time, pool->processes[slot].pID, TRACEEXPIRED);
+                if (key == VRUNTIME)
+                    Charge(&pool->processes[slot], time - cores[cpu].sliceStart);
+                if (key == LEVELS && pool->processes[slot].level < simulation->feedback.levels - 1)
+                    pool->processes[slot].level++;
+                Enqueue(simulation, QueueOf(simulation, cpu), slot, key);
+                running--;
+                waiting++;
             }
-            /* Since the difference is negative, it must be added to the quantum in order the actual execution time of the process */
-            time += quantum + difference;
-            processesCompleted++; /* It's indicated that a process finished it's execution procedure */
-            for (int k = 1; k < numberOfProcess; k++) {
-                /* The processes are hauled at the top and the process at the top position it's "destroyed" since none of it's information 
-                 it is stored elsewhere */
-                processList[k - 1] =  processList[k];
+        
+        /* Every process returns to the first level from time to time, which also happens to the processes that arrived during
+         a long time without processes */
+        if (time >= nextBoost) {
+            Boost(simulation);
+            nextBoost = (time / boost + 1) * boost;
+        }
+        
+        /* The idle CPUs take the best process waiting */
+        for (int cpu = 0; cpu < cpus && waiting > 0; cpu++)
+            if (cores[cpu].running == -1) {
+                int slot = TakeProcess(simulation, cpu, key);
+                if (slot != -1) {
+                    Dispatch(simulation, cpu, slot, time, key, quantum);
+                    running++;
+                    waiting--;
+                }
             }
+        
+        if (policy->preemptive)
+            Preempt(simulation, time, key, quantum);
+        
+        /* The next event is the next arrival, the first slice or I/O burst that ends or the next boost */
+        if (source->status == 1)
+            next = source->next.arrivalTime;
+        if (running > 0 && nextBoost < next)
+            next = nextBoost;
+        for (int cpu = 0; cpu < cpus; cpu++)
+            if (cores[cpu].running != -1 && cores[cpu].sliceEnd < next)
+                next = cores[cpu].sliceEnd;
+        for (int device = 0; device < numberOfDevices; device++)
+            if (devices[device].serving != -1 && devices[device].end < next)
+                next = devices[device].end;
+        
+        /* Nothing is left, or the source failed */
+        if (next == LLONG_MAX)
+            break;
+        time = next;
+    }
+    
+    for (int cpu = 0; cpu < cpus; cpu++) {
+        ReportCPU(&simulation->report, cpu, cores[cpu].busy, time - simulation->start);
+        simulation->result.busy += cores[cpu].busy;
+    }
+    EndRun(simulation);
+}
+
+/* Every algorithm for many CPUs is an engine with it's queue policy */
+#define MULTICPUENGINE(name, policy)                                                            \
+    static void name(struct simulation *simulation, struct processSource *source, int quantum){ \
+        RunMultiCPU(simulation, source, &policy, quantum);                                      \
+    }
+
+MULTICPUENGINE(RunFirstComeMulti, firstComeQueues)
+MULTICPUENGINE(RunShortestJobMulti, shortestJobQueues)
+MULTICPUENGINE(RunPriorityFirstMulti, priorityFirstQueues)
+MULTICPUENGINE(RunShortestRemainingMulti, shortestRemainingQueues)
+MULTICPUENGINE(RunPriorityPreemptiveMulti, priorityPreemptiveQueues)
+MULTICPUENGINE(RunRoundRobinMulti, roundRobinQueues)
+MULTICPUENGINE(RunFeedbackMulti, feedbackQueues)
+MULTICPUENGINE(RunFairMulti, fairQueues)
+MULTICPUENGINE(RunDeadlineMulti, deadlineQueues)
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunAlgorithm                                               */
+/*                                                                       */
+/*  Purpose: Runs one algorithm over the processes of a source, with the */
+/*           engine for one CPU or for many. The Multilevel Feedback     */
+/*           Queue, the Completely Fair Scheduler, Earliest Deadline     */
+/*           First, the workloads with I/O cycles and the context        */
+/*           switches that cost time only have the engine for many CPUs, */
+/*           which works with one as well                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the source of the processes, the */
+/*                      algorithm and the quantum for Round Robin and    */
+/*                      the Multilevel Feedback Queue                    */
+/*                                                                       */
+/*            Output:   The context changes and the average wait time    */
+/*                                                                       */
+/*************************************************************************/
+static void RunAlgorithm(struct simulation *simulation, struct processSource *source, int algorithm, int quantum){
+    if (simulation->machine.cpus > 1 || algorithm == MLFQ || algorithm == CFS || algorithm == EDF ||
+        (simulation->workload && simulation->workload->cycleCount > 0) || simulation->costs.context > 0) {
+        switch (algorithm) {
+            case FCFS:
+                RunFirstComeMulti(simulation, source, quantum);
+                break;
+            case SJF:
+                RunShortestJobMulti(simulation, source, quantum);
+                break;
+            case PRIORITYNP:
+                RunPriorityFirstMulti(simulation, source, quantum);
+                break;
+            case SRTF:
+                RunShortestRemainingMulti(simulation, source, quantum);
+                break;
+            case PRIORITYP:
+                RunPriorityPreemptiveMulti(simulation, source, quantum);
+                break;
+            case ROUNDROBIN:
+                RunRoundRobinMulti(simulation, source, quantum);
+                break;
+            case MLFQ:
+                RunFeedbackMulti(simulation, source, quantum);
+                break;
+            case CFS:
+                RunFairMulti(simulation, source, quantum);
+                break;
+            case EDF:
+                RunDeadlineMulti(simulation, source, quantum);
+                break;
         }
+        return;
     }
     
-    /* The sum of the waiting times of the processes is found */
-    for (int i = 0; i < numberOfProcess; i++) {
-        /* The "classical" solution it's applied, the only thing to consider it's to multiply the last executions to the quantum, due to the fact
-         that the last execution unities indicate only a fully section with full quantum already executed */
-        processListCopy[i].waitTime = processListCopy[i].firstExecuted - processListCopy[i].arrivalTime - (processListCopy[i].lastExecuted * quantum);
-        averageWaitTime = averageWaitTime + processListCopy[i].waitTime; /* The waiting times are added to the accumulated variable */
+    switch (algorithm) {
+        case FCFS:
+            RunFirstCome(simulation, source);
+            break;
+        case SJF:
+            RunShortestJob(simulation, source);
+            break;
+        case PRIORITYNP:
+            RunPriorityFirst(simulation, source);
+            break;
+        case SRTF:
+            RunShortestRemaining(simulation, source);
+            break;
+        case PRIORITYP:
+            RunPriorityPreemptive(simulation, source);
+            break;
+        case ROUNDROBIN:
+            RunRoundRobin(simulation, source, quantum);
+            break;
     }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FirstComeFS                                                */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the First Come First Served algorithm                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time                  */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void FirstComeFS(struct simulation *simulation){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, FCFS);
+    RunAlgorithm(simulation, &source, FCFS, 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: NonPreemptive                                              */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the Non Preemptive algorithms                               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time, and the         */
+/*                      algorithm that is going to be used               */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void NonPreemptive(struct simulation *simulation, int algorithm){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, algorithm == CPUBURST ? SJF : PRIORITYNP);
+    RunAlgorithm(simulation, &source, algorithm == CPUBURST ? SJF : PRIORITYNP, 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Preemptive                                                 */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the Preemptive algorithms                                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time, and the         */
+/*                      algorithm that is going to be used               */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void Preemptive(struct simulation *simulation, int algorithm){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, algorithm == CPUBURST ? SRTF : PRIORITYP);
+    RunAlgorithm(simulation, &source, algorithm == CPUBURST ? SRTF : PRIORITYP, 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RoundRobin                                                 */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the Round Robin algorithm. Furthermore, the context changes */
+/*           are printed and shown to the user                           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time, and the quantum */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void RoundRobin(struct simulation *simulation, int quantum){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, ROUNDROBIN);
+    RunAlgorithm(simulation, &source, ROUNDROBIN, quantum);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FeedbackQueue                                              */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the Multilevel Feedback Queue. The processes arrive in the  */
+/*           first level, go one level lower every time they spend their */
+/*           quantum, and are interrupted by the processes of the levels */
+/*           above. From time to time every process goes back to the     */
+/*           first level                                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time, and the quantum */
+/*                      of the first level                               */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void FeedbackQueue(struct simulation *simulation, int quantum){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, MLFQ);
+    RunAlgorithm(simulation, &source, MLFQ, quantum);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FairScheduler                                              */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           the Completely Fair Scheduler. The process with the lowest  */
+/*           virtual runtime is executed for a slice of the target       */
+/*           latency in proportion to it's weight, and it's virtual      */
+/*           runtime grows with the time it was executed divided by it's */
+/*           weight, so the CPU is shared by priority without starving   */
+/*           anyone                                                      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time, and the quantum */
+/*                      used as the minimum granularity                  */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time and the context changes        */
+/*                                                                       */
+/*************************************************************************/
+void FairScheduler(struct simulation *simulation, int quantum){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
+    
+    ReportStart(&simulation->report, CFS);
+    RunAlgorithm(simulation, &source, CFS, quantum);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: EarliestDeadline                                           */
+/*                                                                       */
+/*  Purpose: Generates the wait time for each of the processes using     */
+/*           Earliest Deadline First. The process with the earliest      */
+/*           deadline is executed, and it is interrupted when a process  */
+/*           with an earlier one arrives. The processes without a        */
+/*           deadline go after all the others                            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, whose workload will be used for  */
+/*                      computing the average wait time                  */
+/*                                                                       */
+/*            Output:   All the process list information considering the */
+/*                      average wait time, the context changes and the   */
+/*                      deadlines missed                                 */
+/*                                                                       */
+/*************************************************************************/
+void EarliestDeadline(struct simulation *simulation){
+    struct processSource source = {.read = ListRead, .data = simulation}; /* The processes of the workload */
     
-    /* The sum is divided by the number of processes in order to obtain
-     the average waiting time */
-    averageWaitTime /= numberOfProcess;
+    ReportStart(&simulation->report, EDF);
+    RunAlgorithm(simulation, &source, EDF, 0);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Schedule                                                   */
+/*                                                                       */
+/*  Purpose: Runs one of the algorithms over the workload of a           */
+/*           simulation                                                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the algorithm and the quantum    */
+/*                      for Round Robin                                  */
+/*                                                                       */
+/*            Output:   The context changes and the average wait time    */
+/*                                                                       */
+/*************************************************************************/
+void Schedule(struct simulation *simulation, int algorithm, int quantum){
+    switch (algorithm) {
+        case FCFS:
+            FirstComeFS(simulation);
+            break;
+        case SJF:
+            NonPreemptive(simulation, CPUBURST);
+            break;
+        case PRIORITYNP:
+            NonPreemptive(simulation, PRIORITY);
+            break;
+        case SRTF:
+            Preemptive(simulation, CPUBURST);
+            break;
+        case PRIORITYP:
+            Preemptive(simulation, PRIORITY);
+            break;
+        case ROUNDROBIN:
+            RoundRobin(simulation, quantum);
+            break;
+        case MLFQ:
+            FeedbackQueue(simulation, quantum);
+            break;
+        case CFS:
+            FairScheduler(simulation, quantum);
+            break;
+        case EDF:
+            EarliestDeadline(simulation);
+            break;
+    }
+}
 
-    printf("\n|                           |");
-    printf("\n| Average Wait Time:  %2.2f  |\n", averageWaitTime); /* The average waiting time is shown */
-    printf("|                           |\n");
-    printf(" ---------------------------\n\n");
-}
\ No newline at end of file
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StreamProcesses                                            */
+/*                                                                       */
+/*  Purpose: Runs one algorithm over processes that are read while the   */
+/*           simulation goes on, already in order of arrival. A process  */
+/*           is read only when the simulation reaches it's arrival time, */
+/*           and it is printed and forgotten when it finishes, so the    */
+/*           memory used depends on the processes that are in the system */
+/*           at the same time and not on the length of the input         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The simulation, the source of the processes, the */
+/*                      algorithm and the quantum for Round Robin        */
+/*                                                                       */
+/*            Output:   Every process that finishes and the average wait */
+/*                      time. If the source fails, no more processes     */
+/*                      arrive and the ones in the system are finished   */
+/*                                                                       */
+/*************************************************************************/
+void StreamProcesses(struct simulation *simulation, struct processSource *source, int algorithm, int quantum){
+    simulation->report.stream = 1;
+    ReportStart(&simulation->report, algorithm);
+    RunAlgorithm(simulation, source, algorithm, quantum);
+    simulation->report.stream = 0;
+}
@@ -8,25 +8,54 @@
 /*          Mario García Navarro                                         */
 /*                                                                       */
 /* Purpose:                                                              */
-/*          Implement routines that simulate a dispatcher in 6           */
-/*          different algorithms                                         */
+/*          Implement routines that simulate a dispatcher in 9           */
+/*          different algorithms, over one CPU or many                   */
 /*                                                                       */
 /* References:                                                           */
 /*          Abelardo López Lagunas code shown during class lab           */
 /*                                                                       */
 /* Restrictions:                                                         */
+/*          Must be included after stdio.h, Queue.h and Report.h         */
 /*                                                                       */
 /* Revision history:                                                     */
 /*          Sep  17 01:21 2014 -- File created                           */
 /*                                                                       */
+/*          Oct  17 15:10 2026 -- Sources of processes for streaming     */
+/*                                                                       */
+/*          Oct  17 17:05 2026 -- Workloads and simulation contexts      */
+/*                                                                       */
+/*          Oct  17 18:40 2026 -- Results of a simulation                */
+/*                                                                       */
+/*          Oct  17 20:15 2026 -- Reports of a simulation                */
+/*                                                                       */
+/*          Oct  17 21:00 2026 -- Traces of a simulation                 */
+/*                                                                       */
+/*          Oct  17 22:10 2026 -- Simulations with many CPUs             */
+/*                                                                       */
+/*          Oct  17 23:00 2026 -- Multilevel Feedback Queue              */
+/*                                                                       */
+/*          Oct  17 23:40 2026 -- Completely Fair Scheduler              */
+/*                                                                       */
+/*          Oct  17 23:55 2026 -- Deadlines and Earliest Deadline First  */
+/*                                                                       */
+/*          Oct  17 23:56 2026 -- CPU and I/O burst cycles, and devices  */
+/*                                                                       */
+/*          Oct  17 23:57 2026 -- Cost of the context switches           */
+/*                                                                       */
+/*          Oct  17 23:58 2026 -- Percentiles of the times               */
+/*                                                                       */
+/*          Oct  17 23:59 2026 -- The workloads are stored as columns    */
+/*                                                                       */
 /* Error handling:                                                       */
 /*          None                                                         */
 /*                                                                       */
 /* Notes:                                                                */
-/*          Six different algoritms will be implemented with the purpose */
-/*          of simulate the behaviour of diverse dispatchers. The        */
-/*          average time of the processes will be obtained in order      */
-/*          to conclude which is the best algorithm in these terms       */
+/*          Nine different algorithms are implemented with the purpose   */
+/*          of simulate the behaviour of diverse dispatchers: the six    */
+/*          classic ones, the Multilevel Feedback Queue, the Completely  */
+/*          Fair Scheduler and Earliest Deadline First. The times of the */
+/*          processes are obtained in order to conclude which is the     */
+/*          best algorithm in these terms                                */
 /*                                                                       */
 /*************************************************************************/
 
@@ -35,17 +64,164 @@
 /*                  Declare the function prototypes                     */
 /************************************************************************/
 
-enum processKeys {PID = 0, ARRIVALTIME, CPUBURST, PRIORITY};
-
-void CreateProcessList(int pID, int arrivalTime, int cpuBurst, int priority);
-void printProcesses();
-void SortProcessList(int sortBy);
-void Sort(int sortBy, int start, int end);
-int Treatment();
-void InverseTreatment(int firstArrival,  int numberOfProcesses);
-void CopyProcessList();
-void RestoreProcessList();
-void FirstComeFS();
-void NonPreemptive(int algorithm);
-void Preemptive(int algorithm);
-void RoundRobin(int quantum);
+enum processKeys {PID = 0, ARRIVALTIME, CPUBURST, PRIORITY, DEADLINE};
+enum algorithms {FCFS = 0, SJF, PRIORITYNP, SRTF, PRIORITYP, ROUNDROBIN, MLFQ, CFS, EDF, NUMALGORITHMS};
+enum deadlineKinds {ABSOLUTEDEADLINES = 0, RELATIVEDEADLINES};
+enum dispatchPolicies {GLOBALQUEUE = 0, WORKSTEALING, NUMPOLICIES};
+
+#define MAXCPUS 4096             /* The most CPUs that can be simulated */
+#define DEFAULTLEVELS 3     /* Levels of the Multilevel Feedback Queue */
+#define BOOSTQUANTA 20     /* Default time between boosts, in quanta of
+                                                      the last level */
+#define LATENCYGRANULES 8  /* Default target latency of the Completely
+                             Fair Scheduler, in minimum granularities */
+#define NODEADLINE INT_MAX      /* The deadline of a process without one */
+#define MAXDEVICES 4096       /* The most I/O devices that can be simulated */
+
+struct process{
+    int pID;                                           /* The process ID */
+    int priority;        /* This is important for the Priority Algorithm */
+    int cpuBurst;                             /* Lenght of the CPU burst */
+    int arrivalTime;                         /* Time of process creation */
+    long long ioTime;            /* Time spent blocked in the I/O devices */
+    long long firstExecuted;  /* Time of first execution, or -1 if none */
+    long long lastExecuted;  /* Time units of the current CPU burst
+                                                  executed so far */
+    int cpu;           /* The last CPU that executed it, or -1 if none */
+    int level;            /* It's level in the Multilevel Feedback Queue */
+    int deadline;  /* When it should finish, as given in the file, or
+                                                       NODEADLINE */
+    int cycle;   /* It's current CPU burst in the cycles of the workload,
+                                   or -1 if it has only one burst */
+    long long vruntime;  /* The CPU time it received, weighted by it's
+                            priority, for the Completely Fair Scheduler */
+};
+
+struct processSource{
+    int (*read)(void *data, struct process *process); /* Gives the next
+                              process in order of arrival. Returns 1 if a
+                              process was given, 0 at the end or -1 if
+                                                      there is an error */
+    void *data;                       /* Information used by the read */
+    struct process next;               /* The next process to arrive */
+    int status;                     /* The result of the last read */
+};
+
+struct processPool{
+    struct process *processes;   /* The processes that are in the system */
+    int *freeSlots;        /* Slots of processes that already finished */
+    int count;                                     /* Slots in use */
+    int capacity;                                 /* Slots allocated */
+    int freeCount;                               /* Free slots */
+};
+
+struct machine{
+    int cpus;                                      /* Number of CPUs */
+    int policy;         /* A queue for all the CPUs, or one per CPU that
+                           steals from the others when it is empty */
+    int devices;    /* Number of I/O devices, each one with it's queue */
+};
+
+struct device{
+    struct runQueue queue;     /* The processes waiting for the device */
+    int serving;  /* Slot of the process being served, or -1 if idle */
+    long long end;               /* When the request being served ends */
+};
+
+struct feedback{
+    int levels;                                   /* Number of levels */
+    int quanta[MAXLEVELS];  /* The quantum of every level, or 0 for the
+                        quantum of the workload doubled at every level */
+    long long boost;    /* Time between the moves of every process to the
+                first level, 0 for none or -1 for BOOSTQUANTA quanta of
+                                                      the last level */
+};
+
+struct fairness{
+    long long latency;    /* Time in which every process waiting should
+                             be executed, or 0 for LATENCYGRANULES
+                                                     granularities */
+    long long granularity;  /* The shortest slice, or 0 for the quantum
+                                                     of the workload */
+};
+
+struct switchCosts{
+    long long context;   /* Time a CPU spends on every context switch */
+    long long migration;   /* Extra time when the process comes from
+                                                   another CPU */
+};
+
+struct core{
+    int running;    /* Slot of the process being executed, or -1 if idle */
+    int lastPID;                 /* The last process that was executed */
+    long long sliceStart;            /* The running process got the CPU */
+    long long sliceEnd;    /* The running process finishes or spends it's
+                                                                quantum */
+    long long busy;                   /* Time spent executing processes */
+    struct readyQueue ready;    /* The processes waiting for this CPU, or */
+    struct runQueue run;        /* for all of them if this is the first   */
+    struct levelQueue levels;   /* CPU and they have a global queue       */
+    long long minVruntime;  /* The virtual runtime given to the processes
+                               that arrive at the queues of the CPU */
+    long long load;       /* The weights of the processes of the queues, */
+    int tasks;            /* waiting or being executed, and their number */
+};
+
+struct workload{
+    int *pID;     /* The processes to be simulated, one column per field */
+    int *arrivalTime;         /* and the same position in every column */
+    int *cpuBurst;
+    int *priority;
+    int *deadline;
+    int *cycle;   /* The first of the cycles of every process, or -1 */
+    int count;                                /* Number of processes */
+    int capacity;  /* Processes that fit before the columns must grow */
+    int *cycles;    /* The CPU and I/O bursts of the processes that have
+                       more than one CPU burst, alternated and ended by 0 */
+    int cycleCount;                        /* Bursts in the cycles */
+    int cycleCapacity;   /* Bursts that fit before the cycles must grow */
+};
+
+struct simulation{
+    const struct workload *workload; /* The processes, which are never
+                                  modified while the algorithms run */
+    int next;             /* Next process of the workload to arrive */
+    struct machine machine;          /* The CPUs and how they are used */
+    struct feedback feedback;    /* The Multilevel Feedback Queue levels */
+    struct fairness fairness;  /* Slices of the Completely Fair Scheduler */
+    struct switchCosts costs;    /* Time charged for the context switches */
+    int deadlines;  /* The deadlines are absolute, or relative to the
+                                                          arrival */
+    struct core *cores;                             /* State of the CPUs */
+    struct device *devices;                  /* State of the I/O devices */
+    long long start;           /* Arrival of the first process of the run */
+    struct simulationResult result;   /* The results of the last run */
+    struct latencies *latencies; /* Histograms of the times of the run */
+    struct report report;          /* Where the results are written */
+    struct traceWriter *trace;  /* Where the slices are traced, or NULL */
+    struct readyQueue ready;   /* Scratch queues and pool of processes,  */
+    struct runQueue run;       /* which keep their memory from one run   */
+    struct processPool pool;   /* to the next one                        */
+};
+
+void ReserveProcessList(struct workload *workload, int capacity);
+void FreeProcessList(struct workload *workload);
+void CreateProcessList(struct workload *workload, int pID, int arrivalTime, int cpuBurst, int priority, int deadline);
+void AddProcessCycles(struct workload *workload, const int *bursts, int count);
+void SortProcessList(struct workload *workload, int sortBy);
+void AddProcessColumns(struct workload *workload, int count, const int pID[], const int arrivalTime[], const int cpuBurst[],
+                       const int priority[], const int deadline[]);
+const int *ProcessColumn(const struct workload *workload, int field);
+void InitSimulation(struct simulation *simulation, const struct workload *workload, FILE *out, int format);
+void FreeSimulation(struct simulation *simulation);
+int DispatchPolicy(const char *name);
+void SetMachine(struct simulation *simulation, const struct machine *machine);
+void FirstComeFS(struct simulation *simulation);
+void NonPreemptive(struct simulation *simulation, int algorithm);
+void Preemptive(struct simulation *simulation, int algorithm);
+void RoundRobin(struct simulation *simulation, int quantum);
+void FeedbackQueue(struct simulation *simulation, int quantum);
+void FairScheduler(struct simulation *simulation, int quantum);
+void EarliestDeadline(struct simulation *simulation);
+void Schedule(struct simulation *simulation, int algorithm, int quantum);
+void StreamProcesses(struct simulation *simulation, struct processSource *source, int algorithm, int quantum);
@@ -0,0 +1,433 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Queue.c                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Ready queue used by the dispatcher algorithms to know which  */
+/*          process must be executed next                                */
+/*                                                                       */
+/* References:                                                           */
+/*          Binary heap as described in any data structures textbook    */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 10:02 2026 - File created                            */
+/*                                                                       */
+/*          Oct  17 12:05 2026 - Added the FIFO run queue                */
+/*                                                                       */
+/*          Oct  17 23:00 2026 - Added the queue of levels               */
+/*                                                                       */
+/*          Oct  17 23:40 2026 - The keys of the ready queue are long    */
+/*                               long, for the virtual runtimes          */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The ready queue counts the entries it   */
+/*                               compares and moves                      */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If the memory for the queue can not be obtained, the program */
+/*          exits                                                        */
+/*                                                                       */
+/* Notes:                                                                */
+/*          Inserting and removing a process costs O(log n) in the ready */
+/*          queue, so the algorithms do not need to sort the waiting     */
+/*          processes again every time a new one arrives. The run queue  */
+/*          is a circular buffer, so both operations cost O(1). The      */
+/*          queue of levels keeps a bitmap of the levels that have       */
+/*          processes, so the first one is found with a single           */
+/*          instruction and it's operations cost O(1) as well            */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                  /* Used to handle the FILE type */
+#include <stdlib.h>        /* Used for the memory allocation functions */
+#include "FileIO.h"                     /* Used for the ErrorMsg function */
+#include "Queue.h"                                     /* Function header */
+
+#define INITIALENTRIES 16      /* Initial capacity of an empty ready queue */
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Precedes                                                   */
+/*                                                                       */
+/*  Purpose: Tells if a process must be executed before another one. The */
+/*           lowest key goes first and the ties are broken with the      */
+/*           lowest process ID, as the sorting of the process list does  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The two entries of the queue to compare          */
+/*                                                                       */
+/*            Output:   1 if the first entry goes first, 0 otherwise     */
+/*                                                                       */
+/*************************************************************************/
+static int Precedes(const struct readyEntry *first, const struct readyEntry *second){
+    if (first->key != second->key)
+        return (first->key < second->key);
+    
+    return (first->pID < second->pID);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: InitReadyQueue                                             */
+/*                                                                       */
+/*  Purpose: Creates an empty ready queue                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue and how many processes it should hold  */
+/*                      before it has to grow                            */
+/*                                                                       */
+/*            Output:   The empty queue                                  */
+/*                                                                       */
+/*************************************************************************/
+void InitReadyQueue(struct readyQueue *queue, int capacity){
+    if (capacity < INITIALENTRIES)
+        capacity = INITIALENTRIES;
+    
+    queue->entries = malloc((size_t)capacity * sizeof(struct readyEntry));
+    if (!queue->entries){
+        ErrorMsg("'InitReadyQueue'", "Not enough memory for the ready queue");
+        exit(EXIT_FAILURE);
+    }
+    
+    queue->size = 0;
+    queue->capacity = capacity;
+    queue->comparisons = queue->swaps = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FreeReadyQueue                                             */
+/*                                                                       */
+/*  Purpose: Releases the memory used by a ready queue                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void FreeReadyQueue(struct readyQueue *queue){
+    free(queue->entries);
+    queue->entries = NULL;
+    queue->size = queue->capacity = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PushReadyQueue                                             */
+/*                                                                       */
+/*  Purpose: Inserts a process in the ready queue. The new entry is      */
+/*           placed at the bottom of the heap and climbs while it goes   */
+/*           before it's parent                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue, the key used for the order, the       */
+/*                      process ID and the position of the process in    */
+/*                      the list                                         */
+/*                                                                       */
+/*            Output:   The queue with the new process                   */
+/*                                                                       */
+/*************************************************************************/
+void PushReadyQueue(struct readyQueue *queue, long long key, int pID, int index){
+    struct readyEntry entry;                     /* The entry to insert */
+    int child, parent;             /* Positions while climbing the heap */
+    
+    /* Double the capacity if the queue is full */
+    if (queue->size == queue->capacity){
+        struct readyEntry *entries = realloc(queue->entries, (size_t)queue->capacity * 2 * sizeof(struct readyEntry));
+        if (!entries){
+            ErrorMsg("'PushReadyQueue'", "Not enough memory for the ready queue");
+            exit(EXIT_FAILURE);
+        }
+        queue->entries = entries;
+        queue->capacity *= 2;
+    }
+    
+    entry.key = key;
+    entry.pID = pID;
+    entry.index = index;
+    
+    /* Move the parents down until the place of the new entry is found */
+    child = queue->size++;
+    while (child > 0){
+        parent = (child - 1) / 2;
+        queue->comparisons++;
+        if (!Precedes(&entry, &queue->entries[parent]))
+            break;
+        queue->entries[child] = queue->entries[parent];
+        queue->swaps++;
+        child = parent;
+    }
+    queue->entries[child] = entry;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PopReadyQueue                                              */
+/*                                                                       */
+/*  Purpose: Removes the process at the top of the ready queue. The last */
+/*           entry of the heap takes it's place and sinks while one of   */
+/*           it's children goes before it. The queue must not be empty   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   The process that must be executed next           */
+/*                                                                       */
+/*************************************************************************/
+struct readyEntry PopReadyQueue(struct readyQueue *queue){
+    struct readyEntry top = queue->entries[0];        /* Entry removed */
+    struct readyEntry last = queue->entries[--queue->size]; /* Entry that
+                                                       fills the hole */
+    int parent = 0, child;          /* Positions while sinking the heap */
+    
+    /* Move the best child up until the place of the last entry is found */
+    while ((child = 2 * parent + 1) < queue->size){
+        queue->comparisons += child + 1 < queue->size ? 2 : 1;
+        if (child + 1 < queue->size && Precedes(&queue->entries[child + 1], &queue->entries[child]))
+            child++;
+        if (!Precedes(&queue->entries[child], &last))
+            break;
+        queue->entries[parent] = queue->entries[child];
+        queue->swaps++;
+        parent = child;
+    }
+    if (queue->size > 0)
+        queue->entries[parent] = last;
+    
+    return top;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: InitRunQueue                                               */
+/*                                                                       */
+/*  Purpose: Creates an empty run queue                                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue and how many processes it should hold  */
+/*                      before it has to grow                            */
+/*                                                                       */
+/*            Output:   The empty queue                                  */
+/*                                                                       */
+/*************************************************************************/
+void InitRunQueue(struct runQueue *queue, int capacity){
+    int slots = INITIALENTRIES;         /* The capacity, a power of two */
+    
+    while (slots < capacity)
+        slots *= 2;
+    
+    queue->slots = malloc((size_t)slots * sizeof(int));
+    if (!queue->slots){
+        ErrorMsg("'InitRunQueue'", "Not enough memory for the run queue");
+        exit(EXIT_FAILURE);
+    }
+    
+    queue->head = queue->size = 0;
+    queue->capacity = slots;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FreeRunQueue                                               */
+/*                                                                       */
+/*  Purpose: Releases the memory used by a run queue                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void FreeRunQueue(struct runQueue *queue){
+    free(queue->slots);
+    queue->slots = NULL;
+    queue->head = queue->size = queue->capacity = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PushRunQueue                                               */
+/*                                                                       */
+/*  Purpose: Inserts a process at the end of the run queue. If the       */
+/*           buffer is full it doubles, and the processes are unrolled   */
+/*           so the first one is at the beginning of the new buffer. A   */
+/*           queue without buffer gets one now                           */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue and the position of the process in the */
+/*                      list                                             */
+/*                                                                       */
+/*            Output:   The queue with the new process                   */
+/*                                                                       */
+/*************************************************************************/
+void PushRunQueue(struct runQueue *queue, int index){
+    if (queue->size == queue->capacity){
+        int capacity = queue->capacity ? queue->capacity * 2 : INITIALENTRIES; /* The new capacity */
+        int *slots = malloc((size_t)capacity * sizeof(int));
+        if (!slots){
+            ErrorMsg("'PushRunQueue'", "Not enough memory for the run queue");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < queue->size; i++)
+            slots[i] = queue->slots[(queue->head + i) & (queue->capacity - 1)];
+        
+        free(queue->slots);
+        queue->slots = slots;
+        queue->head = 0;
+        queue->capacity = capacity;
+    }
+    
+    queue->slots[(queue->head + queue->size) & (queue->capacity - 1)] = index;
+    queue->size++;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PopRunQueue                                                */
+/*                                                                       */
+/*  Purpose: Removes the first process of the run queue. The queue must  */
+/*           not be empty                                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   The position of the process in the list          */
+/*                                                                       */
+/*************************************************************************/
+int PopRunQueue(struct runQueue *queue){
+    int index = queue->slots[queue->head];           /* Process removed */
+    
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+    
+    return index;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: InitLevelQueue                                             */
+/*                                                                       */
+/*  Purpose: Creates an empty queue of levels. The FIFO of every level   */
+/*           gets it's buffer when the first process is inserted, so     */
+/*           the levels that are never used cost no memory               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   The empty queue                                  */
+/*                                                                       */
+/*************************************************************************/
+void InitLevelQueue(struct levelQueue *queue){
+    for (int level = 0; level < MAXLEVELS; level++)
+        queue->levels[level] = (struct runQueue){0};
+    
+    queue->nonEmpty = 0;
+    queue->size = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FreeLevelQueue                                             */
+/*                                                                       */
+/*  Purpose: Releases the memory used by a queue of levels               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void FreeLevelQueue(struct levelQueue *queue){
+    for (int level = 0; level < MAXLEVELS; level++)
+        FreeRunQueue(&queue->levels[level]);
+    
+    queue->nonEmpty = 0;
+    queue->size = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: EmptyLevelQueue                                            */
+/*                                                                       */
+/*  Purpose: Removes all the processes of a queue of levels, which keeps */
+/*           it's memory                                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   The empty queue                                  */
+/*                                                                       */
+/*************************************************************************/
+void EmptyLevelQueue(struct levelQueue *queue){
+    for (int level = 0; level < MAXLEVELS; level++)
+        queue->levels[level].head = queue->levels[level].size = 0;
+    
+    queue->nonEmpty = 0;
+    queue->size = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PushLevelQueue                                             */
+/*                                                                       */
+/*  Purpose: Inserts a process at the end of a level                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue, the level and the position of the     */
+/*                      process in the list                              */
+/*                                                                       */
+/*            Output:   The queue with the new process                   */
+/*                                                                       */
+/*************************************************************************/
+void PushLevelQueue(struct levelQueue *queue, int level, int index){
+    PushRunQueue(&queue->levels[level], index);
+    queue->nonEmpty |= 1ULL << level;
+    queue->size++;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PopLevel                                                   */
+/*                                                                       */
+/*  Purpose: Removes the first process of a level, which must not be     */
+/*           empty                                                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue and the level                          */
+/*                                                                       */
+/*            Output:   The position of the process in the list          */
+/*                                                                       */
+/*************************************************************************/
+int PopLevel(struct levelQueue *queue, int level){
+    int index = PopRunQueue(&queue->levels[level]);   /* Process removed */
+    
+    if (queue->levels[level].size == 0)
+        queue->nonEmpty &= ~(1ULL << level);
+    queue->size--;
+    
+    return index;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: TopLevel                                                   */
+/*                                                                       */
+/*  Purpose: Finds the lowest level that has processes, which is the     */
+/*           lowest bit set in the bitmap                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The queue                                        */
+/*                                                                       */
+/*            Output:   The level, or -1 if the queue is empty           */
+/*                                                                       */
+/*************************************************************************/
+int TopLevel(const struct levelQueue *queue){
+    return (queue->nonEmpty ? __builtin_ctzll(queue->nonEmpty) : -1);
+}
@@ -0,0 +1,90 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Queue.h                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Ready queue used by the dispatcher algorithms to know which  */
+/*          process must be executed next                                */
+/*                                                                       */
+/* References:                                                           */
+/*          Binary heap as described in any data structures textbook    */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 10:02 2026 -- File created                           */
+/*                                                                       */
+/*          Oct  17 12:05 2026 -- Added the FIFO run queue               */
+/*                                                                       */
+/*          Oct  17 23:00 2026 -- Added the queue of levels              */
+/*                                                                       */
+/*          Oct  17 23:40 2026 -- Keys of the ready queue are long long  */
+/*                                                                       */
+/*          Oct  17 23:59 2026 -- Counters of the ready queue            */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If the memory for the queue can not be obtained, the program */
+/*          exits                                                        */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The ready queue keeps the process with the lowest key at the */
+/*          top. If two processes have the same key, the one with the    */
+/*          lowest process ID goes first. The run queue is a plain FIFO, */
+/*          and the queue of levels has a FIFO per level, the lowest     */
+/*          level going first                                            */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+struct readyEntry{
+    long long key;  /* CPU burst, priority or virtual runtime of the process */
+    int pID;                       /* The process ID, used to break ties */
+    int index;                    /* Position of the process in the list */
+};
+
+struct readyQueue{
+    struct readyEntry *entries;                  /* The heap of processes */
+    int size;                            /* Processes waiting in the queue */
+    int capacity;                 /* Processes that fit before it must grow */
+    long long comparisons;            /* Entries compared, for the stats */
+    long long swaps;                     /* Entries moved in the heap */
+};
+
+struct runQueue{
+    int *slots;              /* Circular buffer with the process positions */
+    int head;                       /* Slot of the first process waiting */
+    int size;                            /* Processes waiting in the queue */
+    int capacity;     /* Slots in the buffer, always a power of two */
+};
+
+#define MAXLEVELS 64   /* The most levels, one per bit of the bitmap */
+
+struct levelQueue{
+    struct runQueue levels[MAXLEVELS];   /* The processes of every level */
+    unsigned long long nonEmpty;       /* Bit i is set if level i has any */
+    int size;                  /* Processes waiting in all the levels */
+};
+
+void InitReadyQueue(struct readyQueue *queue, int capacity);
+void FreeReadyQueue(struct readyQueue *queue);
+void PushReadyQueue(struct readyQueue *queue, long long key, int pID, int index);
+struct readyEntry PopReadyQueue(struct readyQueue *queue);
+void InitRunQueue(struct runQueue *queue, int capacity);
+void FreeRunQueue(struct runQueue *queue);
+void PushRunQueue(struct runQueue *queue, int index);
+int PopRunQueue(struct runQueue *queue);
+void InitLevelQueue(struct levelQueue *queue);
+void FreeLevelQueue(struct levelQueue *queue);
+void EmptyLevelQueue(struct levelQueue *queue);
+void PushLevelQueue(struct levelQueue *queue, int level, int index);
+int PopLevel(struct levelQueue *queue, int level);
+int TopLevel(const struct levelQueue *queue);
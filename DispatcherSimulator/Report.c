@@ -0,0 +1,629 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Report.c                                                   */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Reports of the dispatcher algorithms, written through a big  */
+/*          buffer in one of several formats                             */
+/*                                                                       */
+/* References:                                                           */
+/*          RFC 4180 for CSV and the JSON Lines text format              */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          A report must be used by one thread at a time                */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 20:15 2026 - File created                            */
+/*                                                                       */
+/*          Oct  17 22:10 2026 - The CPU of every context change and the */
+/*                               time every CPU was busy                 */
+/*                                                                       */
+/*          Oct  17 23:55 2026 - The deadlines missed and the lateness   */
+/*                                                                       */
+/*          Oct  17 23:56 2026 - The CPU utilization and the throughput  */
+/*                               of the workloads with I/O bursts        */
+/*                                                                       */
+/*          Oct  17 23:57 2026 - The overhead of the context switches    */
+/*                                                                       */
+/*          Oct  17 23:58 2026 - The distributions of the waiting,       */
+/*                               response and turnaround times, and the  */
+/*                               throughput of every algorithm           */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The bytes written and the time spent on */
+/*                               them are counted for the stats          */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If the memory for the buffer can not be obtained, the        */
+/*          program exits                                                */
+/*                                                                       */
+/* Notes:                                                                */
+/*          Printing a context change with printf was the slowest part   */
+/*          of a big simulation. The numbers of the records are now      */
+/*          converted by hand into a buffer of one megabyte, which is    */
+/*          written to the file only when it is full and at the end of   */
+/*          every algorithm                                              */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                      /* Used for the function fwrite */
+#include <stdlib.h>        /* Used for the memory allocation functions */
+#include <string.h>                       /* Used for the function memcpy */
+#include "FileIO.h"                     /* Used for the ErrorMsg function */
+#include "Report.h"                                    /* Function header */
+#include "Queue.h"               /* Needed by the process definitions */
+#include "Process.h"                 /* Used for the list of algorithms */
+#include "Stats.h"                    /* Used for the monotonic clock */
+
+#define REPORTBUFFER 1<<20               /* Size of the buffer in bytes */
+#define MAXRECORD 2048        /* The longest record that can be written */
+#define NUMTIMES 3          /* The times with a distribution in the results */
+
+static const char *times[NUMTIMES] = {"wait", "response", "turnaround"};
+
+static const char *timeTitles[NUMTIMES] = {"Wait", "Response", "Turnaround"};  /* In the boxes */
+
+static const char *names[NUMALGORITHMS] = {"fcfs", "sjf", "priority", "srtf", "ppriority", "rr", "mlfq", "cfs", "edf"};
+
+static const char *titles[NUMALGORITHMS] = {      /* Centered in 27 characters */
+    "  First Come First Served  ", "     SJF Non Preemptive    ", "  Priority Non Preemptive  ",
+    "       SJF Preemptive      ", "    Priority Preemptive    ", "        Round Robin        ",
+    " Multilevel Feedback Queue ", " Completely Fair Scheduler ", "  Earliest Deadline First  "};
+
+static const char *formats[NOREPORT] = {"boxes", "summary", "csv", "jsonl"};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: AlgorithmName                                              */
+/*                                                                       */
+/*  Purpose: Gives the short name of an algorithm, as it is used in the  */
+/*           command line and in the records                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The algorithm                                    */
+/*                                                                       */
+/*            Output:   The name                                         */
+/*                                                                       */
+/*************************************************************************/
+const char *AlgorithmName(int algorithm){
+    return names[algorithm];
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportFormat                                               */
+/*                                                                       */
+/*  Purpose: Finds a format of the reports by it's name                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name: boxes, summary, csv or jsonl           */
+/*                                                                       */
+/*            Output:   The format, or -1 if the name is unknown         */
+/*                                                                       */
+/*************************************************************************/
+int ReportFormat(const char *name){
+    for (int format = 0; format < NOREPORT; format++)
+        if (strcmp(name, formats[format]) == 0)
+            return format;
+    
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenReport                                                 */
+/*                                                                       */
+/*  Purpose: Prepares a report to be written to a file                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report, the file and the format              */
+/*                                                                       */
+/*            Output:   The report, with an empty buffer                 */
+/*                                                                       */
+/*************************************************************************/
+void OpenReport(struct report *report, FILE *out, int format){
+    *report = (struct report){.out = out, .format = format, .cpus = 1};
+    
+    if (format == NOREPORT)
+        return;
+    
+    report->buffer = malloc(REPORTBUFFER);
+    if (!report->buffer) {
+        ErrorMsg("'OpenReport'", "Not enough memory for the report");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteBuffer                                                */
+/*                                                                       */
+/*  Purpose: Writes the buffer of a report to it's file, counting the    */
+/*           bytes and the time it takes                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   The report, with an empty buffer                 */
+/*                                                                       */
+/*************************************************************************/
+static void WriteBuffer(struct report *report){
+    double start = Now();                    /* When the writing began */
+    
+    fwrite(report->buffer, 1, report->length, report->out);
+    report->written += (long long)report->length;
+    report->writing += Now() - start;
+    report->length = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FlushReport                                                */
+/*                                                                       */
+/*  Purpose: Writes the buffer of a report to it's file                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   The report, with an empty buffer                 */
+/*                                                                       */
+/*************************************************************************/
+void FlushReport(struct report *report){
+    if (report->length > 0)
+        WriteBuffer(report);
+    if (report->format != NOREPORT)
+        fflush(report->out);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CloseReport                                                */
+/*                                                                       */
+/*  Purpose: Writes what is left of a report and releases it's buffer.   */
+/*           The file belongs to the caller and is not closed            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void CloseReport(struct report *report){
+    FlushReport(report);
+    free(report->buffer);
+    report->buffer = NULL;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Reserve                                                    */
+/*                                                                       */
+/*  Purpose: Makes sure that a record fits in the buffer of a report,    */
+/*           writing the buffer to the file if it does not               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   Where the record must be written                 */
+/*                                                                       */
+/*************************************************************************/
+static char *Reserve(struct report *report){
+    if (report->length > (REPORTBUFFER) - MAXRECORD)
+        WriteBuffer(report);
+    
+    return report->buffer + report->length;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PutText                                                    */
+/*                                                                       */
+/*  Purpose: Copies a string to a record                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   Where the record goes and the string             */
+/*                                                                       */
+/*            Output:   Where the record continues                       */
+/*                                                                       */
+/*************************************************************************/
+static char *PutText(char *record, const char *text){
+    size_t length = strlen(text);              /* Length of the string */
+    
+    memcpy(record, text, length);
+    return record + length;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PutNumber                                                  */
+/*                                                                       */
+/*  Purpose: Writes a number to a record, filled with spaces at the left */
+/*           up to a width, as printf does with "%2lld"                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   Where the record goes, the number and the width  */
+/*                                                                       */
+/*            Output:   Where the record continues                       */
+/*                                                                       */
+/*************************************************************************/
+static char *PutNumber(char *record, long long number, int width){
+    char digits[24];               /* The digits, from the last one */
+    int count = 0;                           /* How many digits */
+    unsigned long long value = number < 0 ? 0ULL - (unsigned long long)number : (unsigned long long)number;
+    
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    if (number < 0)
+        digits[count++] = '-';
+    
+    while (width-- > count)
+        *record++ = ' ';
+    while (count > 0)
+        *record++ = digits[--count];
+    
+    return record;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportHeader                                               */
+/*                                                                       */
+/*  Purpose: Writes the names of the columns of a CSV report, which must */
+/*           be done once before the reports of all the algorithms       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   The names of the columns                         */
+/*                                                                       */
+/*************************************************************************/
+void ReportHeader(struct report *report){
+    if (report->format == CSV)
+        report->length = (size_t)(PutText(Reserve(report), "record,algorithm,time,pid,wait,processes,average_wait,"
+                                          "average_turnaround,context_switches,migrations,cpu,busy,"
+                                          "utilization,deadline_misses,total_lateness,max_lateness,throughput,overhead,"
+                                          "times,mean,p50,p90,p99,p999,max\n") - report->buffer);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportStart                                                */
+/*                                                                       */
+/*  Purpose: Starts the report of an algorithm. The boxes and the        */
+/*           summary show it's name inside a box                         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report and the algorithm                     */
+/*                                                                       */
+/*            Output:   The start of the report                          */
+/*                                                                       */
+/*************************************************************************/
+void ReportStart(struct report *report, int algorithm){
+    char *record;                                  /* The next record */
+    
+    report->algorithm = algorithm;
+    if (report->format == NOREPORT)
+        return;
+    record = Reserve(report);
+    
+    switch (report->format) {
+        case BOXES:
+        case SUMMARY:
+            record = PutText(record, " ---------------------------\n|");
+            record = PutText(record, titles[algorithm]);
+            record = PutText(record, "|\n ---------------------------");
+            break;
+    }
+    
+    report->length = (size_t)(record - report->buffer);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportDispatch                                             */
+/*                                                                       */
+/*  Purpose: Reports a context change, when a process starts to be       */
+/*           executed. The boxes of Round Robin have always been written */
+/*           without the space at the end, and the boxes only show the   */
+/*           CPU when there is more than one                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report, the time, the process ID and the CPU */
+/*                                                                       */
+/*            Output:   The context change                               */
+/*                                                                       */
+/*************************************************************************/
+void ReportDispatch(struct report *report, long long time, int pID, int cpu){
+    char *record;                                      /* The record */
+    
+    switch (report->format) {
+        case BOXES:
+            if (report->stream)
+                return;
+            record = PutText(Reserve(report), "\n|        t    =   ");
+            record = PutNumber(record, time, 2);
+            record = PutText(record, "        |\n|        Process: ");
+            record = PutNumber(record, pID, 2);
+            if (report->cpus > 1) {
+                record = PutText(record, "        |\n|        CPU:     ");
+                record = PutNumber(record, cpu, 2);
+            }
+            record = PutText(record, report->algorithm == ROUNDROBIN ? "        |\n ---------------------------" :
+                             "        |\n --------------------------- ");
+            break;
+        case CSV:
+            record = PutText(Reserve(report), "dispatch,");
+            record = PutText(record, names[report->algorithm]);
+            record = PutText(record, ",");
+            record = PutNumber(record, time, 0);
+            record = PutText(record, ",");
+            record = PutNumber(record, pID, 0);
+            record = PutText(record, ",,,,,,,");
+            record = PutNumber(record, cpu, 0);
+            record = PutText(record, ",,,,,,,,,,,,,,\n");
+            break;
+        case JSONLINES:
+            record = PutText(Reserve(report), "{\"record\":\"dispatch\",\"algorithm\":\"");
+            record = PutText(record, names[report->algorithm]);
+            record = PutText(record, "\",\"time\":");
+            record = PutNumber(record, time, 0);
+            record = PutText(record, ",\"pid\":");
+            record = PutNumber(record, pID, 0);
+            record = PutText(record, ",\"cpu\":");
+            record = PutNumber(record, cpu, 0);
+            record = PutText(record, "}\n");
+            break;
+        default:
+            return;
+    }
+    
+    report->length = (size_t)(record - report->buffer);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportFinish                                               */
+/*                                                                       */
+/*  Purpose: Reports a process that finished it's execution. The boxes   */
+/*           only show it when the processes are streamed                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report, the time, the process ID and it's    */
+/*                      waiting time                                     */
+/*                                                                       */
+/*            Output:   The finished process                             */
+/*                                                                       */
+/*************************************************************************/
+void ReportFinish(struct report *report, long long time, int pID, long long waitTime){
+    char *record;                                      /* The record */
+    
+    switch (report->format) {
+        case BOXES:
+            if (!report->stream)
+                return;
+            record = PutText(Reserve(report), "\n| Process: ");
+            record = PutNumber(record, pID, 2);
+            record = PutText(record, "  Finish: ");
+            record = PutNumber(record, time, 2);
+            record = PutText(record, "  Wait: ");
+            record = PutNumber(record, waitTime, 2);
+            record = PutText(record, " |");
+            break;
+        case CSV:
+            record = PutText(Reserve(report), "finish,");
+            record = PutText(record, names[report->algorithm]);
+            record = PutText(record, ",");
+            record = PutNumber(record, time, 0);
+            record = PutText(record, ",");
+            record = PutNumber(record, pID, 0);
+            record = PutText(record, ",");
+            record = PutNumber(record, waitTime, 0);
+            record = PutText(record, ",,,,,,,,,,,,,,,,,,,,\n");
+            break;
+        case JSONLINES:
+            record = PutText(Reserve(report), "{\"record\":\"finish\",\"algorithm\":\"");
+            record = PutText(record, names[report->algorithm]);
+            record = PutText(record, "\",\"time\":");
+            record = PutNumber(record, time, 0);
+            record = PutText(record, ",\"pid\":");
+            record = PutNumber(record, pID, 0);
+            record = PutText(record, ",\"wait\":");
+            record = PutNumber(record, waitTime, 0);
+            record = PutText(record, "}\n");
+            break;
+        default:
+            return;
+    }
+    
+    report->length = (size_t)(record - report->buffer);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportCPU                                                  */
+/*                                                                       */
+/*  Purpose: Reports the time a CPU spent executing processes, and which */
+/*           part of the simulation it was. It is only written when      */
+/*           there is more than one CPU                                  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report, the CPU, it's busy time and the time */
+/*                      from the first arrival to the last finish        */
+/*                                                                       */
+/*            Output:   The use of the CPU                               */
+/*                                                                       */
+/*************************************************************************/
+void ReportCPU(struct report *report, int cpu, long long busy, long long span){
+    double utilization = span > 0 ? (double)busy / (double)span : 0.0; /* Part of the time it was busy */
+    char *record;                                      /* The record */
+    
+    if (report->format == NOREPORT || report->cpus < 2)
+        return;
+    record = Reserve(report);
+    
+    switch (report->format) {
+        case BOXES:
+        case SUMMARY:
+            record += sprintf(record, "\n| CPU %3d busy: %6.2f%%     |", cpu, 100.0 * utilization);
+            break;
+        case CSV:
+            record += sprintf(record, "cpu,%s,,,,,,,,,%d,%lld,%.6f,,,,,,,,,,,,\n", names[report->algorithm], cpu, busy, utilization);
+            break;
+        case JSONLINES:
+            record += sprintf(record, "{\"record\":\"cpu\",\"algorithm\":\"%s\",\"cpu\":%d,\"busy\":%lld,"
+                              "\"utilization\":%.6f}\n", names[report->algorithm], cpu, busy, utilization);
+            break;
+    }
+    
+    report->length = (size_t)(record - report->buffer);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PutDistribution                                            */
+/*                                                                       */
+/*  Purpose: Writes the distribution of one of the times of the results  */
+/*           in the format of the report                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   Where the record goes, the report, the time      */
+/*                      (wait, response or turnaround) and it's          */
+/*                      distribution                                     */
+/*                                                                       */
+/*            Output:   Where the record continues                       */
+/*                                                                       */
+/*************************************************************************/
+static char *PutDistribution(char *record, const struct report *report, int time, const struct distribution *values){
+    static const char *labels[] = {"p50", "p90", "p99", "p99.9", "max"};  /* Shown in the boxes */
+    long long percentiles[] = {values->p50, values->p90, values->p99, values->p999, values->max};
+    int width = 25 - (int)strlen(timeTitles[time]);  /* Room left in a box line */
+    
+    switch (report->format) {
+        case BOXES:
+        case SUMMARY:
+            record += sprintf(record, "\n| %s mean:%*.2f |", timeTitles[time], width - 6, values->mean);
+            for (int i = 0; i < 5; i++)
+                record += sprintf(record, "\n| %s %s:%*lld |", timeTitles[time], labels[i],
+                                  width - (int)strlen(labels[i]) - 2, percentiles[i]);
+            break;
+        case CSV:
+            record += sprintf(record, "distribution,%s,,,,,,,,,,,,,,,,,%s,%.6f,%lld,%lld,%lld,%lld,%lld\n", names[report->algorithm],
+                              times[time], values->mean, values->p50, values->p90, values->p99, values->p999, values->max);
+            break;
+        case JSONLINES:
+            record += sprintf(record, ",\"%s\":{\"mean\":%.6f,\"p50\":%lld,\"p90\":%lld,\"p99\":%lld,\"p999\":%lld,\"max\":%lld}",
+                              times[time], values->mean, values->p50, values->p90, values->p99, values->p999, values->max);
+            break;
+    }
+    
+    return record;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportEnd                                                  */
+/*                                                                       */
+/*  Purpose: Ends the report of an algorithm with it's results, and      */
+/*           writes the buffer to the file. The deadlines missed are     */
+/*           only shown when some process had a deadline, and the use of */
+/*           all the CPUs and the processes finished per unit of time    */
+/*           when some process blocked for I/O or the context switches   */
+/*           cost time. The use counts only the time executing processes */
+/*           The distributions of the times and the throughput are       */
+/*           always written in CSV and JSON Lines, and only shown in the */
+/*           boxes when the report asks for the percentiles              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report and the results of the algorithm      */
+/*                                                                       */
+/*            Output:   The results                                      */
+/*                                                                       */
+/*************************************************************************/
+void ReportEnd(struct report *report, const struct simulationResult *result){
+    long long processes = result->processes;    /* Processes that finished */
+    float averageWaitTime = processes > 0 ? (float)result->totalWaitTime / processes : 0.0f; /* As it was always shown */
+    double averageWait = processes > 0 ? (double)result->totalWaitTime / processes : 0.0;
+    double averageTurnaround = processes > 0 ? (double)result->totalTurnaround / processes : 0.0;
+    double utilization = result->span > 0 ? (double)result->busy / ((double)result->span * report->cpus) : 0.0;
+    double throughput = result->span > 0 ? (double)processes / (double)result->span : 0.0; /* Processes per unit of time */
+    int timed = result->ioBursts > 0 || result->overhead > 0;  /* Were the CPUs idle or switching part of the time? */
+    const struct distribution *distributions[NUMTIMES] = {&result->wait, &result->response, &result->turnaround};
+    char *record;                                      /* The record */
+    
+    if (report->format == NOREPORT)
+        return;
+    record = Reserve(report);
+    
+    switch (report->format) {
+        case BOXES:
+        case SUMMARY:
+            if (report->cpus > 1)
+                record += sprintf(record, "\n| Migrations: %13lld |", result->migrations);
+            if (result->deadlines > 0)
+                record += sprintf(record, "\n| Deadline misses: %8lld |\n| Total lateness: %9lld |\n| Max lateness: %11lld |",
+                                  result->deadlineMisses, result->totalLateness, result->maxLateness);
+            if (result->ioBursts > 0)
+                record += sprintf(record, "\n| I/O bursts: %13lld |", result->ioBursts);
+            if (result->overhead > 0)
+                record += sprintf(record, "\n| Context switches: %7lld |\n| Switch overhead: %8lld |",
+                                  result->contextSwitches, result->overhead);
+            if (timed)
+                record += sprintf(record, "\n| CPU utilization: %7.2f%% |", 100.0 * utilization);
+            if (timed || report->percentiles)
+                record += sprintf(record, "\n| Throughput: %13.4f |", throughput);
+            if (report->percentiles)
+                for (int i = 0; i < NUMTIMES; i++)
+                    record = PutDistribution(record, report, i, distributions[i]);
+            record += sprintf(record, "\n|                           |\n| Average Wait Time:  %.2f  |\n"
+                              "|                           |\n ---------------------------\n\n", averageWaitTime);
+            break;
+        case CSV:
+            record += sprintf(record, "summary,%s,,,,%lld,%.6f,%.6f,%lld,%lld,", names[report->algorithm], processes,
+                              averageWait, averageTurnaround, result->contextSwitches, result->migrations);
+            if (timed)
+                record += sprintf(record, ",%lld,%.6f", result->busy, utilization);
+            else
+                record = PutText(record, ",,");
+            if (result->deadlines > 0)
+                record += sprintf(record, ",%lld,%lld,%lld", result->deadlineMisses, result->totalLateness, result->maxLateness);
+            else
+                record = PutText(record, ",,,");
+            record += sprintf(record, ",%.6f", throughput);
+            if (result->overhead > 0)
+                record += sprintf(record, ",%lld,,,,,,,\n", result->overhead);
+            else
+                record = PutText(record, ",,,,,,,,\n");
+            for (int i = 0; i < NUMTIMES; i++)
+                record = PutDistribution(record, report, i, distributions[i]);
+            break;
+        case JSONLINES:
+            record += sprintf(record, "{\"record\":\"summary\",\"algorithm\":\"%s\",\"processes\":%lld,"
+                              "\"total_wait\":%lld,\"total_turnaround\":%lld,\"average_wait\":%.6f,"
+                              "\"average_turnaround\":%.6f,\"context_switches\":%lld,\"migrations\":%lld",
+                              names[report->algorithm], processes, result->totalWaitTime, result->totalTurnaround,
+                              averageWait, averageTurnaround, result->contextSwitches, result->migrations);
+            if (result->deadlines > 0)
+                record += sprintf(record, ",\"deadline_misses\":%lld,\"total_lateness\":%lld,\"max_lateness\":%lld",
+                                  result->deadlineMisses, result->totalLateness, result->maxLateness);
+            if (result->ioBursts > 0)
+                record += sprintf(record, ",\"io_bursts\":%lld", result->ioBursts);
+            if (result->overhead > 0)
+                record += sprintf(record, ",\"overhead\":%lld", result->overhead);
+            if (timed)
+                record += sprintf(record, ",\"busy\":%lld,\"utilization\":%.6f", result->busy, utilization);
+            record += sprintf(record, ",\"throughput\":%.6f", throughput);
+            for (int i = 0; i < NUMTIMES; i++)
+                record = PutDistribution(record, report, i, distributions[i]);
+            record = PutText(record, "}\n");
+            break;
+    }
+    
+    report->length = (size_t)(record - report->buffer);
+    FlushReport(report);
+}
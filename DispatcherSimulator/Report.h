@@ -0,0 +1,110 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Report.h                                                   */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Reports of the dispatcher algorithms, written through a big  */
+/*          buffer in one of several formats                             */
+/*                                                                       */
+/* References:                                                           */
+/*          RFC 4180 for CSV and the JSON Lines text format              */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          Must be included after stdio.h                               */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 20:15 2026 -- File created                           */
+/*                                                                       */
+/*          Oct  17 22:10 2026 -- Reports of many CPUs                   */
+/*                                                                       */
+/*          Oct  17 23:55 2026 -- Deadlines missed                       */
+/*                                                                       */
+/*          Oct  17 23:56 2026 -- Utilization and throughput with I/O    */
+/*                                                                       */
+/*          Oct  17 23:57 2026 -- Overhead of the context switches       */
+/*                                                                       */
+/*          Oct  17 23:58 2026 -- Distributions of the times             */
+/*                                                                       */
+/*          Oct  17 23:59 2026 -- Bytes written and time spent on them   */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If the memory for the buffer can not be obtained, the        */
+/*          program exits                                                */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The boxes are the original format. The summary only gives    */
+/*          the results of every algorithm, and CSV and JSON Lines give  */
+/*          one record per context change, per finished process and per  */
+/*          algorithm, to be read by other programs                      */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+enum reportFormats {BOXES = 0, SUMMARY, CSV, JSONLINES, NOREPORT};
+
+struct distribution{
+    double mean;                           /* The mean of the times */
+    long long p50;                          /* The median of the times */
+    long long p90;                   /* 90% of the times are not longer */
+    long long p99;                   /* 99% of the times are not longer */
+    long long p999;                /* 99.9% of the times are not longer */
+    long long max;                             /* The longest time */
+};
+
+struct simulationResult{
+    long long processes;                  /* Processes that finished */
+    long long totalWaitTime;     /* Sum of the waiting times */
+    long long totalTurnaround;   /* Sum of the turnaround times */
+    long long contextSwitches;  /* Times the CPU got another process */
+    long long migrations; /* Times a process ran in another CPU than the
+                                                           last time */
+    long long deadlines;      /* Processes with a deadline that finished */
+    long long deadlineMisses;      /* Those that finished after it */
+    long long totalLateness;   /* Sum of the time they finished late */
+    long long maxLateness;        /* The latest finish after a deadline */
+    long long ioBursts;     /* Times a process blocked in an I/O device */
+    long long busy;    /* Time the CPUs spent executing processes */
+    long long overhead;  /* Time the CPUs spent on context switches */
+    long long span;   /* Time from the first arrival to the last event */
+    long long events;      /* Iterations of the loop of the algorithm */
+    long long comparisons;       /* Entries compared in the ready queues */
+    long long swaps;                /* Entries moved in the ready queues */
+    struct distribution wait;           /* The waiting times */
+    struct distribution response;  /* From the arrival to the first CPU */
+    struct distribution turnaround;    /* The turnaround times */
+};
+
+struct report{
+    FILE *out;                      /* Where the results are written */
+    int format;                              /* The format of the report */
+    int stream;    /* Write the processes as they finish, instead of the
+                                     context changes, in the boxes */
+    int percentiles;   /* Show the distributions of the times in the boxes */
+    int algorithm;                   /* The algorithm being reported */
+    int cpus;         /* Number of CPUs, shown in the boxes if not one */
+    char *buffer;                 /* The text not written to the file */
+    size_t length;                    /* Bytes used in the buffer */
+    long long written;           /* Bytes written to the file, for the stats */
+    double writing;           /* Seconds spent writing them, for the stats */
+};
+
+const char *AlgorithmName(int algorithm);
+int ReportFormat(const char *name);
+void OpenReport(struct report *report, FILE *out, int format);
+void CloseReport(struct report *report);
+void FlushReport(struct report *report);
+void ReportHeader(struct report *report);
+void ReportStart(struct report *report, int algorithm);
+void ReportDispatch(struct report *report, long long time, int pID, int cpu);
+void ReportFinish(struct report *report, long long time, int pID, long long waitTime);
+void ReportCPU(struct report *report, int cpu, long long busy, long long span);
+void ReportEnd(struct report *report, const struct simulationResult *result);
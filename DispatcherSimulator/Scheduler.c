@@ -22,17 +22,150 @@
 /*                                                                       */
 /*          schedule file.txt                                            */
 /*                                                                       */
+/*          The nine algorithms can run at the same time, one per        */
+/*          processor or over the number of threads given, with the      */
+/*          results printed in the same order:                           */
+/*                                                                       */
+/*          schedule --parallel file.txt [threads]                       */
+/*                                                                       */
+/*          Round Robin can be evaluated with a list of quanta, given as */
+/*          numbers and ranges such as 1-20, 10-100:10 or 1,2,4,8. The   */
+/*          quanta run at the same time and a table is printed:          */
+/*                                                                       */
+/*          schedule --sweep file.txt quanta [threads]                   */
+/*                                                                       */
+/*          A synthetic workload can be written in the standard output,  */
+/*          or used to measure every phase of the simulator with a       */
+/*          thousand processes and up to ten million (or "max="). The    */
+/*          options are given as name=value; see Generator.c:            */
+/*                                                                       */
+/*          schedule --generate [count=n] [arrivals=poisson|bursty] ...  */
+/*          schedule --bench [max=n] [arrivals=poisson|bursty] ...       */
+/*                                                                       */
+/*          The results are shown in boxes. Before any other parameter,  */
+/*          --summary shows only the average of every algorithm, and     */
+/*          --csv or --jsonl write one record per context change, per    */
+/*          finished process and per algorithm, for other programs:      */
+/*                                                                       */
+/*          schedule --csv [--parallel] file.txt                         */
+/*                                                                       */
+/*          The algorithms simulate one CPU. Before any other parameter, */
+/*          --cpus=n simulates n CPUs, and --policy=global (the default) */
+/*          gives them a single queue, while --policy=steal gives every  */
+/*          CPU it's own queue, stealing from the others when it is      */
+/*          empty. The time every CPU was busy is reported:              */
+/*                                                                       */
+/*          schedule --cpus=64 --policy=steal [--summary] file.txt       */
+/*                                                                       */
+/*          The Multilevel Feedback Queue has three levels, with the     */
+/*          quantum of the file doubled at every level, and every        */
+/*          process returns to the first level each 20 quanta of the     */
+/*          last one. Before any other parameter, --levels=n changes the */
+/*          number of levels, --quanta=list gives the quantum of every   */
+/*          level, and --boost=t the time between boosts (0 for none):   */
+/*                                                                       */
+/*          schedule --quanta=2,8,32 --boost=500 file.txt                */
+/*                                                                       */
+/*          The Completely Fair Scheduler uses the priority as a nice    */
+/*          value. It's minimum granularity is the quantum of the file   */
+/*          and it's target latency 8 granularities. Before any other    */
+/*          parameter, --granularity=t and --latency=t change them:      */
+/*                                                                       */
+/*          schedule --latency=48 --granularity=4 --stream cfs file.txt  */
+/*                                                                       */
+/*          A process may have a deadline as a fifth number in it's      */
+/*          line. Earliest Deadline First executes the process with the  */
+/*          earliest one, and every algorithm reports the deadlines      */
+/*          missed, their total lateness and the maximum. The deadlines  */
+/*          are absolute unless --deadlines=relative goes before any     */
+/*          other parameter, which counts them from the arrival:         */
+/*                                                                       */
+/*          schedule --deadlines=relative --stream edf file.txt          */
+/*                                                                       */
+/*          After the deadline, if any, a process may have a | and pairs */
+/*          of an I/O burst and a CPU burst. A process that completes a  */
+/*          CPU burst waits in the FIFO queue of it's I/O device, chosen */
+/*          by it's process ID, and every algorithm reports the CPU      */
+/*          utilization and the throughput. Before any other parameter,  */
+/*          --devices=n simulates n devices instead of one:              */
+/*                                                                       */
+/*          1 0 12 3 40 | 5 8 2 6                                        */
+/*                                                                       */
+/*          schedule --devices=4 --summary file.txt                      */
+/*                                                                       */
+/*          The context switches are free. Before any other parameter,   */
+/*          --switch-cost=t makes every context switch take t units of   */
+/*          time of the CPU, and --migration-cost=t adds t more when the */
+/*          process was executed by another CPU. The overhead, the CPU   */
+/*          utilization and the throughput are reported, and the sweep  */
+/*          of quanta shows the overhead of every quantum:               */
+/*                                                                       */
+/*          schedule --switch-cost=1 --sweep file.txt 1-20               */
+/*                                                                       */
+/*          The mean, the percentiles 50, 90, 99 and 99.9 and the        */
+/*          maximum of the waiting, response and turnaround times are    */
+/*          always written in the CSV and JSON Lines reports. Before any */
+/*          other parameter, --percentiles also shows them in the boxes: */
+/*                                                                       */
+/*          schedule --percentiles --summary file.txt                    */
+/*                                                                       */
+/*          Before any other parameter, --stats writes in the standard   */
+/*          error the time of the reading, the sorting and every         */
+/*          algorithm, with the comparisons and moves of the ready       */
+/*          queues, the events, the context switches and the bytes of    */
+/*          the report, as CSV lines that start with "stats":            */
+/*                                                                       */
+/*          schedule --stats --parallel file.txt 2> stats.csv            */
+/*                                                                       */
+/*          On Linux, --profile also writes the cycles, instructions,    */
+/*          cache misses and branch misses of every algorithm, with the  */
+/*          instructions per cycle and the misses per process, as lines  */
+/*          that start with "profile". The counters the system does not  */
+/*          allow are left empty, and if none is allowed there is no     */
+/*          profile:                                                     */
+/*                                                                       */
+/*          schedule --profile --summary file.txt 2> profile.csv         */
+/*                                                                       */
+/*          The Gantt chart of one algorithm can be written to a binary  */
+/*          trace, with one record per slice of the CPU, which is later  */
+/*          summarized or decoded as text:                               */
+/*                                                                       */
+/*          schedule --trace algorithm file.txt file.trace               */
+/*          schedule --read-trace file.trace [decode]                    */
+/*                                                                       */
+/*          The processes can also be streamed, already in order of      */
+/*          arrival, through one algorithm (fcfs, sjf, priority, srtf,   */
+/*          ppriority, rr, mlfq, cfs or edf). They are read from the     */
+/*          file, or from the standard input if it is "-" or missing:    */
+/*                                                                       */
+/*          schedule --stream algorithm [file.txt]                       */
+/*                                                                       */
+/*          A text file can be converted to a binary workload, which is  */
+/*          accepted by the first form in place of the text file and     */
+/*          starts much faster:                                          */
+/*                                                                       */
+/*          schedule --convert file.txt file.bin                         */
+/*                                                                       */
 /* References:                                                           */
 /*          The material that describe the scheduling algorithms is      */
 /*          covered in the class notes for TC2008                        */
 /*                                                                       */
 /* File formats:                                                         */
 /*          The input file should have four numbers per list in ASCII    */
-/*          format. The exception is the first line which only has one   */
-/*          integer number that represents the quantum                   */
+/*          format, and optionally a fifth one with the deadline,        */
+/*          followed by the pairs of I/O and CPU bursts. The exception   */
+/*          is the first line which only has one integer number that     */
+/*          represents the quantum                                       */
+/*                                                                       */
+/*          The binary workload has a header (magic number, version,     */
+/*          quantum, flags and number of processes) followed by four     */
+/*          columns of ints: process ID, arrival time, CPU burst and     */
+/*          priority, and a fifth one of deadlines if it's flags say so. */
+/*          See FileIO.h                                                 */
 /*                                                                       */
 /* Restrictions:                                                         */
 /*          If the input file is not in ASCII format the program exits   */
+/*          reporting the line and column of the first wrong character   */
 /*                                                                       */
 /* Revision history:                                                     */
 /*                                                                       */
@@ -42,6 +175,63 @@
 /*                                                                       */
 /*          Sep 20 12:24 2014 - Added scheduling algorithms              */
 /*                                                                       */
+/*          Oct 17 13:30 2026 - Parse errors report line and column      */
+/*                                                                       */
+/*          Oct 17 15:10 2026 - Added the streaming mode                 */
+/*                                                                       */
+/*          Oct 17 16:20 2026 - Added the binary workload format         */
+/*                                                                       */
+/*          Oct 17 17:05 2026 - The workload and the simulation context  */
+/*                              are local, not global                    */
+/*                                                                       */
+/*          Oct 17 18:00 2026 - Added the parallel mode                  */
+/*                                                                       */
+/*          Oct 17 18:40 2026 - Added the quantum sweep                  */
+/*                                                                       */
+/*          Oct 17 19:30 2026 - Added the generator and the benchmark    */
+/*                                                                       */
+/*          Oct 17 20:15 2026 - Added the summary, CSV and JSON Lines    */
+/*                              formats                                  */
+/*                                                                       */
+/*          Oct 17 21:00 2026 - Added the binary traces                  */
+/*                                                                       */
+/*          Oct 17 22:10 2026 - Added the simulation of many CPUs        */
+/*                                                                       */
+/*          Oct 17 23:00 2026 - Added the Multilevel Feedback Queue      */
+/*                                                                       */
+/*          Oct 17 23:40 2026 - Added the Completely Fair Scheduler      */
+/*                                                                       */
+/*          Oct 17 23:55 2026 - Added the deadlines and Earliest         */
+/*                              Deadline First                           */
+/*                                                                       */
+/*          Oct 17 23:56 2026 - Added the I/O cycles and devices         */
+/*                                                                       */
+/*          Oct 17 23:57 2026 - Added the cost of the context switches   */
+/*                                                                       */
+/*          Oct 17 23:58 2026 - Added the percentiles of the times       */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - Added the statistics of the phases       */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - Added the hardware counters profile      */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The binary workloads are loaded and      */
+/*                              written as whole columns                 */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The four parameters of a process must be */
+/*                              in one line, and the I/O cycles go after */
+/*                              a |                                      */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The quantum and the CPU bursts must be   */
+/*                              positive, and the arrival times can not  */
+/*                              be negative                              */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The lists of quanta have a maximum       */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The size of the benchmark is checked     */
+/*                                                                       */
+/*          Oct 17 23:59 2026 - The binary workloads are checked before  */
+/*                              they are used                            */
+/*                                                                       */
 /* Error handling:                                                       */
 /*          On any unrecoverable error, the program exits                */
 /*                                                                       */
@@ -52,81 +242,1370 @@
 
 #include <stdio.h>                       /* Used for the function printf */
 #include <stdlib.h>              /* Used for the EXIT_FAILURE definition */
+#include <string.h>                      /* Used for the function strcmp */
+#include <limits.h>                        /* Used for the INT_MIN value */
+#include <unistd.h>                         /* Used for the function mkstemp */
+#include <sys/resource.h>                /* Used for the function getrusage */
 #include "FileIO.h"       /* Definition of file access support functions */
+#include "Queue.h"            /* Definition of the queues of processes */
+#include "Workers.h"             /* Definition of the pool of threads */
+#include "Report.h"            /* Definition of the reports of results */
+#include "Trace.h"                /* Definition of the traces of the CPU */
 #include "Process.h"           /* Definition of processes creation and
                             computing operations that find the average time 
                                                       for each algorithm */
+#include "Generator.h"         /* Definition of the synthetic workloads */
+#include "Stats.h"         /* Definition of the statistics of the phases */
 
 /*************************************************************************/
 /*                         Global constant values                        */
 /*************************************************************************/
 
 #define NUMPARAMS 2
-#define NUMVAL    4 /* Number of columns in the processes */
+#define NUMVAL    4 /* Number of columns in the processes, besides the
+                                                   optional deadline */
+#define REPORTBLOCK 1<<16     /* Bytes copied at once from a report */
+#define BENCHMARKSIZE 1000  /* Processes of the smallest benchmark size */
+#define BENCHMARKMAX 10000000 /* Processes of the biggest benchmark size */
+#define MAXSWEEP 100000         /* The most quanta evaluated by a sweep */
+
 
 /*************************************************************************/
-/*                            Main entry point                           */
+/*                         Global data types                             */
 /*************************************************************************/
 
-int main (int argc, const char * argv[]) {
+struct settings{
+    int format;                            /* The format of the reports */
+    struct machine machine;             /* The CPUs of the simulations */
+    struct feedback feedback;  /* The Multilevel Feedback Queue levels */
+    struct fairness fairness;  /* Slices of the Completely Fair Scheduler */
+    struct switchCosts costs;    /* Time charged for the context switches */
+    int deadlines;         /* The deadlines are absolute or relative */
+    int percentiles;     /* Show the distributions of the times in boxes */
+    int stats;       /* Write the time and the counters of every phase */
+    int profile;   /* Write the hardware counters of every algorithm */
+};
+
+struct runMeasure{
+    double start;                         /* When the run started */
+    int profile;               /* Are the hardware counters running? */
+    struct hardwareCounters counters;   /* Those of the calling thread */
+};
+
+struct parallelRun{
+    const struct workload *workload;      /* The processes, shared */
+    int quantum;                       /* Quantum value for Round Robin */
+    const struct settings *settings;  /* How the simulations are done */
+    FILE *reports[NUMALGORITHMS];   /* The results of every algorithm */
+    struct phaseStats phases[NUMALGORITHMS];  /* The work of every algorithm */
+};
+
+struct quantumSweep{
+    const struct workload *workload;      /* The processes, shared */
+    const int *quanta;                     /* The quanta to evaluate */
+    const struct settings *settings;  /* How the simulations are done */
+    struct simulationResult *results;    /* The results per quantum */
+};
+
+struct lineNumbers{
+    int *numbers;                   /* The numbers after the separator */
+    int count;                                 /* Numbers in the line */
+    int capacity;      /* Numbers that fit before the buffer must grow */
+};
+
+struct streamInput{
+    struct workloadReader reader;          /* Parses the input in blocks */
+    int lastArrival;            /* Arrival time of the last process read */
+};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReportReaderError                                          */
+/*                                                                       */
+/*  Purpose: Prints the error found by a reader with it's place          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader                                       */
+/*                                                                       */
+/*            Output:   The error message                                */
+/*                                                                       */
+/*************************************************************************/
+static void ReportReaderError(const struct workloadReader *reader){
+    char message[128];                /* Error message with it's location */
+    
+    snprintf(message, sizeof(message), "Line %d, column %d: %s", reader->errorLine, reader->errorColumn, reader->error);
+    ErrorMsg("'main'", message);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadLineNumbers                                            */
+/*                                                                       */
+/*  Purpose: Reads all the numbers left in the line of a process after   */
+/*           the separator: the I/O cycles. The buffer grows as needed   */
+/*           and is kept for the next lines                              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and the buffer                        */
+/*                                                                       */
+/*            Output:   1 with the numbers in the buffer, or -1 if there */
+/*                      is an error, which is kept in the reader. If the */
+/*                      memory can not be obtained the program exits     */
+/*                                                                       */
+/*************************************************************************/
+static int ReadLineNumbers(struct workloadReader *reader, struct lineNumbers *line){
+    line->count = 0;
+    
+    while (NumberInLine(reader)) {
+        if (line->count == line->capacity) {
+            int capacity = line->capacity ? line->capacity * 2 : 16;  /* The new size */
+            int *numbers = realloc(line->numbers, (size_t)capacity * sizeof(int));
+            
+            if (!numbers) {
+                ErrorMsg("'main'", "Not enough memory to read the I/O cycles");
+                exit(EXIT_FAILURE);
+            }
+            line->numbers = numbers;
+            line->capacity = capacity;
+        }
+        if (ReadInt(reader, &line->numbers[line->count++]) != 1)
+            return (-1);
+    }
+    
+    return (reader->error ? -1 : 1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CheckCycles                                                */
+/*                                                                       */
+/*  Purpose: Checks the I/O cycles of a process: they must be pairs of   */
+/*           an I/O burst and a CPU burst, every burst must be positive, */
+/*           and all the CPU bursts together must fit in an int          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader, the first CPU burst, the cycles and  */
+/*                      their number of bursts                           */
+/*                                                                       */
+/*            Output:   1 if they are right, or -1 with the error kept   */
+/*                      in the reader                                    */
+/*                                                                       */
+/*************************************************************************/
+static int CheckCycles(struct workloadReader *reader, int cpuBurst, const int *bursts, int count){
+    long long total = cpuBurst;                  /* All the CPU bursts */
+    
+    if (count == 0 || count % 2 == 1)
+        reader->error = "The I/O cycles must be pairs of an I/O burst and a CPU burst";
+    for (int i = 0; i < count && !reader->error; i++) {
+        if (bursts[i] < 1)
+            reader->error = "The I/O and CPU bursts of the cycles must be positive";
+        else if (i % 2 == 1 && (total += bursts[i]) > INT_MAX)
+            reader->error = "The CPU bursts of the process are too long";
+    }
+    if (!reader->error)
+        return 1;
+    
+    reader->errorLine = reader->line;
+    reader->errorColumn = 1;
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: LineError                                                  */
+/*                                                                       */
+/*  Purpose: Keeps an error of the line being read in the reader         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and the error message                 */
+/*                                                                       */
+/*            Output:   The error status, -1                             */
+/*                                                                       */
+/*************************************************************************/
+static int LineError(struct workloadReader *reader, const char *message){
+    reader->error = message;
+    reader->errorLine = reader->line;
+    reader->errorColumn = 1;
+    
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadQuantum                                                */
+/*                                                                       */
+/*  Purpose: Reads the quantum, the first number of a workload, which    */
+/*           must be positive                                            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader and where to store the quantum        */
+/*                                                                       */
+/*            Output:   1 if the quantum was read, 0 at the end of file  */
+/*                      or -1 if there is an error, which is kept in the */
+/*                      reader                                           */
+/*                                                                       */
+/*************************************************************************/
+static int ReadQuantum(struct workloadReader *reader, int *quantum){
+    int status = ReadInt(reader, quantum);        /* Result of the number */
+    
+    if (status == 1 && *quantum < 1)
+        return LineError(reader, "The quantum must be positive");
+    
+    return status;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadProcessLine                                            */
+/*                                                                       */
+/*  Purpose: Reads the line of a process: the four parameters, all of    */
+/*           them in the line, an optional deadline and, after a |, the  */
+/*           pairs of an I/O burst and a CPU burst of it's cycles:       */
+/*                                                                       */
+/*           pid arrival burst priority [deadline] [| io cpu ...]        */
+/*                                                                       */
+/*           The arrival time can not be negative and the CPU burst must */
+/*           be positive                                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The reader, where to store the parameters and    */
+/*                      the deadline (or NODEADLINE), and the buffer for */
+/*                      the cycles, or NULL if they are not accepted     */
+/*                                                                       */
+/*            Output:   1 if a process was read, 0 at the end of file or */
+/*                      -1 if there is an error, which is kept in the    */
+/*                      reader                                           */
+/*                                                                       */
+/*************************************************************************/
+static int ReadProcessLine(struct workloadReader *reader, int parameters[NUMVAL], int *deadline, struct lineNumbers *cycles){
+    int status = ReadInt(reader, &parameters[0]);   /* The first number */
+    
+    if (status != 1)
+        return status;
+    
+    /* The other parameters can not be taken from the next line */
+    for (int i = 1; i < NUMVAL; i++) {
+        if (!NumberInLine(reader))
+            return (reader->error ? -1 : LineError(reader, "The process needs four numbers"));
+        if (ReadInt(reader, &parameters[i]) != 1)
+            return (-1);
+    }
+    if (parameters[1] < 0)
+        return LineError(reader, "The arrival time can not be negative");
+    if (parameters[2] < 1)
+        return LineError(reader, "The CPU burst must be positive");
+    
+    *deadline = NODEADLINE;
+    if (NumberInLine(reader) && ReadInt(reader, deadline) != 1)
+        return (-1);
+    if (NumberInLine(reader))
+        return LineError(reader, "Only the deadline can follow the four numbers; the I/O cycles go after a |");
+    
+    if (cycles)
+        cycles->count = 0;
+    if (SeparatorInLine(reader)) {
+        if (!cycles)
+            return LineError(reader, "The I/O cycles can not be streamed");
+        if (ReadLineNumbers(reader, cycles) != 1 || CheckCycles(reader, parameters[2], cycles->numbers, cycles->count) != 1)
+            return (-1);
+        if (SeparatorInLine(reader))
+            return LineError(reader, "A line can only have one |");
+    }
+    
+    return (reader->error ? -1 : 1);
+}
 
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StreamRead                                                 */
+/*                                                                       */
+/*  Purpose: Reads the next process of a stream. The four parameters     */
+/*           must be in one line and the arrival times must not          */
+/*           decrease. A fifth number in the line is the deadline. The   */
+/*           I/O cycles need the whole workload, so they can not be      */
+/*           streamed                                                    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The stream and where to store the process        */
+/*                                                                       */
+/*            Output:   1 if a process was read, 0 at the end of the     */
+/*                      stream or -1 if there is an error, which is kept */
+/*                      in the reader                                    */
+/*                                                                       */
+/*************************************************************************/
+static int StreamRead(void *data, struct process *process){
+    struct streamInput *input = data;                    /* The stream */
+    int parameters[NUMVAL];           /* Process parameters in the line */
+    int deadline;                              /* Deadline of the process */
+    int status = ReadProcessLine(&input->reader, parameters, &deadline, NULL); /* Result of the line */
+    
+    if (status != 1)
+        return status;
+    
+    if (parameters[1] < input->lastArrival)
+        return LineError(&input->reader, "The processes are not in order of arrival");
+    input->lastArrival = parameters[1];
+    
+    process->pID = parameters[0];
+    process->arrivalTime = parameters[1];
+    process->cpuBurst = parameters[2];
+    process->priority = parameters[3];
+    process->deadline = deadline;
+    process->ioTime = process->firstExecuted = process->lastExecuted = 0;
+    process->cycle = -1;
+    
+    return 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenSimulation                                             */
+/*                                                                       */
+/*  Purpose: Prepares a simulation context with the CPUs and the levels  */
+/*           given in the command line                                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The context, the workload (or NULL if the        */
+/*                      processes are streamed), where to write the      */
+/*                      report, it's format and the settings             */
+/*                                                                       */
+/*            Output:   The context                                      */
+/*                                                                       */
+/*************************************************************************/
+static void OpenSimulation(struct simulation *simulation, const struct workload *workload, FILE *out, int format,
+                           const struct settings *settings){
+    InitSimulation(simulation, workload, out, format);
+    SetMachine(simulation, &settings->machine);
+    simulation->feedback = settings->feedback;
+    simulation->fairness = settings->fairness;
+    simulation->costs = settings->costs;
+    simulation->deadlines = settings->deadlines;
+    simulation->report.percentiles = settings->percentiles;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: FindAlgorithm                                              */
+/*                                                                       */
+/*  Purpose: Finds an algorithm by it's short name                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name                                         */
+/*                                                                       */
+/*            Output:   The algorithm, or -1 after the error is reported */
+/*                                                                       */
+/*************************************************************************/
+static int FindAlgorithm(const char *name){
+    for (int algorithm = 0; algorithm < NUMALGORITHMS; algorithm++)
+        if (strcmp(name, AlgorithmName(algorithm)) == 0)
+            return algorithm;
+    
+    ErrorMsg("'main'", "Unknown algorithm, use fcfs, sjf, priority, srtf, ppriority, rr, mlfq, cfs or edf");
+    return (-1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StartMeasure                                               */
+/*                                                                       */
+/*  Purpose: Starts to measure the run of an algorithm, with the         */
+/*           hardware counters of the calling thread if the settings ask */
+/*           for a profile                                               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The measure and the settings                     */
+/*                                                                       */
+/*            Output:   The measure, started                             */
+/*                                                                       */
+/*************************************************************************/
+static void StartMeasure(struct runMeasure *measure, const struct settings *settings){
+    measure->profile = settings->profile && OpenCounters(&measure->counters) > 0;
+    measure->start = Now();
+    if (measure->profile)
+        StartCounters(&measure->counters);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: MeasureRun                                                 */
+/*                                                                       */
+/*  Purpose: Ends the measure of the last run of a simulation, keeping   */
+/*           it's time and it's counters. The bytes written by it's      */
+/*           report and the time spent on them are taken, so the next    */
+/*           run starts from zero                                        */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   Where to keep them, or NULL, the algorithm, the  */
+/*                      measure and the simulation                       */
+/*                                                                       */
+/*            Output:   The statistics of the run                        */
+/*                                                                       */
+/*************************************************************************/
+static void MeasureRun(struct phaseStats *phase, int algorithm, struct runMeasure *measure, struct simulation *simulation){
+    long long hardware[NUMHARDWARE] = {-1, -1, -1, -1};  /* The hardware counters */
+    double seconds;                               /* Time of the run */
+    
+    if (measure->profile) {
+        StopCounters(&measure->counters, hardware);
+        CloseCounters(&measure->counters);
+    }
+    seconds = Now() - measure->start;
+    
+    if (phase) {
+        *phase = (struct phaseStats){.name = AlgorithmName(algorithm), .seconds = seconds,
+                                     .writing = simulation->report.writing, .comparisons = simulation->result.comparisons,
+                                     .swaps = simulation->result.swaps, .events = simulation->result.events,
+                                     .switches = simulation->result.contextSwitches, .bytes = simulation->report.written,
+                                     .processes = simulation->result.processes};
+        memcpy(phase->hardware, hardware, sizeof(hardware));
+    }
+    simulation->report.writing = 0.0;
+    simulation->report.written = 0;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Stream                                                     */
+/*                                                                       */
+/*  Purpose: Runs one algorithm over the processes of a stream, which    */
+/*           is read while the simulation goes on. The reading is part   */
+/*           of the time of the algorithm in the statistics              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the algorithm, the file, or "-" for  */
+/*                      the standard input, and the settings             */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Stream(const char *algorithmName, const char *fileName, const struct settings *settings){
+    struct streamInput input;               /* The processes to stream */
+    struct processSource source = {.read = StreamRead, .data = &input};
+    struct simulation simulation;            /* State of the algorithm */
+    int algorithm = FindAlgorithm(algorithmName); /* The algorithm to run */
+    int quantum = 0;                   /* Quantum value for Round Robin */
+    FILE *fp = stdin;                            /* Pointer to the file */
+    int status;                             /* Result of the quantum */
+    
+    if (algorithm == -1)
+        return (EXIT_FAILURE);
+    
+    if (strcmp(fileName, "-") != 0 && !(fp = fopen(fileName, "r"))) {
+        ErrorMsg("'main'","Filename does not exist or is corrupted\n");
+        return (EXIT_FAILURE);
+    }
+    
+    if (OpenReader(&input.reader, fp) == EXIT_FAILURE) {
+        ErrorMsg("'main'","Not enough memory to read the file");
+        return (EXIT_FAILURE);
+    }
+    input.lastArrival = INT_MIN;
+    
+    /* The first number in the stream is the quantum */
+    status = ReadQuantum(&input.reader, &quantum);
+    if (status == 0)
+        ErrorMsg("'main'","The quantum was not found");
+    else if (status < 0)
+        ReportReaderError(&input.reader);
+    else {
+        struct stats stats = {.count = 0};   /* The work of the algorithm */
+        struct runMeasure measure;            /* Measures the algorithm */
+        
+        OpenSimulation(&simulation, NULL, stdout, settings->format, settings);
+        ReportHeader(&simulation.report);
+        StartMeasure(&measure, settings);
+        StreamProcesses(&simulation, &source, algorithm, quantum);
+        MeasureRun(AddPhase(&stats, AlgorithmName(algorithm), 0.0), algorithm, &measure, &simulation);
+        FreeSimulation(&simulation);
+        if (settings->stats)
+            WriteStats(&stats, stderr);
+        if (settings->profile)
+            WriteProfile(&stats, stderr);
+        if (source.status < 0) {
+            ReportReaderError(&input.reader);
+            status = -1;
+        }
+    }
+    
+    CloseReader(&input.reader);
+    if (fp != stdin)
+        fclose(fp);
+    
+    return (status == 1 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadTextWorkload                                           */
+/*                                                                       */
+/*  Purpose: Reads the quantum and all the processes of a text file      */
+/*           into a workload. After the four parameters of a process,    */
+/*           it's line may have the deadline and, after a |, pairs of an */
+/*           I/O burst and a CPU burst                                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file, the workload and where to  */
+/*                      store the quantum                                */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE after the error is */
+/*                      reported                                         */
+/*                                                                       */
+/*************************************************************************/
+static int ReadTextWorkload(const char *fileName, struct workload *workload, int *quantum){
     FILE   *fp;                                  /* Pointer to the file */
-    int    quantum = 0;                /* Quantum value for Round Robin */
     int    parameters[NUMVAL];        /* Process parameters in the line */
-    int    i;                    /* Number of parameters in the process */
+    int    deadline;                          /* Deadline of the process */
+    int    status = 0;      /* Result of the last number read from file */
+    struct workloadReader reader;          /* Parses the file in blocks */
+    struct lineNumbers line = {0};               /* The I/O cycles */
     
-    /* Check if the parameters in the main function are not empty */
-    if (argc < NUMPARAMS){
-        printf("Need a file with the process information\n\n");
-        printf("Abnormal termination\n");
+    /* Open the file and check that it exists */
+    fp = fopen (fileName,"r");          /* Open file for read operation */
+    if (!fp) {                              /* The file does not exists */
+        ErrorMsg("'main'","Filename does not exist or is corrupted\n");
         return (EXIT_FAILURE);
     }
+    
+    /* Size the process list from a quick pre-scan of the file, so
+    it does not need to grow while the processes are read */
+    ReserveProcessList(workload, CountProcesses(fp));
+    
+    /* The file is parsed in big blocks */
+    if (OpenReader(&reader, fp) == EXIT_FAILURE) {
+        ErrorMsg("'main'","Not enough memory to read the file");
+        fclose(fp);
+        return (EXIT_FAILURE);
+    }
+    
+    /* The first number in the file is the quantum */
+    status = ReadQuantum(&reader, quantum);
+
+    if (status == 0) {
+        ErrorMsg("'main'","The quantum was not found");
+        status = -1;
+    }
+    
     else {
+        /* Read the process information until the end of file 
+        is reached. For every line with the four parameters, and the
+        deadline and the I/O cycles, create a new process */
+        while ((status = ReadProcessLine(&reader, parameters, &deadline, &line)) == 1) {
+            CreateProcessList(workload, parameters[0], parameters[1], parameters[2], parameters[3], deadline);
+            if (line.count > 0)
+                AddProcessCycles(workload, line.numbers, line.count);
+        }
         
-        /* Open the file and check that it exists */
-        fp = fopen (argv[1],"r");       /* Open file for read operation */
-        if (!fp)                            /* The file does not exists */
-            ErrorMsg("'main'","Filename does not exist or is corrupted\n");
+        /* The errors are reported with the place where they were found */
+        if (status < 0)
+            ReportReaderError(&reader);
+    }
+    
+    free(line.numbers);
+    CloseReader(&reader);
+    fclose(fp);
+    
+    return (status == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: LoadWorkload                                               */
+/*                                                                       */
+/*  Purpose: Reads all the processes of a file into a workload, sorted   */
+/*           by arrival time. A binary workload is mapped in memory; any */
+/*           other file is parsed as text. The sort is skipped only if   */
+/*           the binary workload says it's sorted and it's arrivals      */
+/*           never decrease                                              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file, the workload, where to     */
+/*                      store the quantum and the statistics where the   */
+/*                      time of the reading and the sorting is added, or */
+/*                      NULL                                             */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE with an empty      */
+/*                      workload                                         */
+/*                                                                       */
+/*************************************************************************/
+static int LoadWorkload(const char *fileName, struct workload *workload, int *quantum, struct stats *stats){
+    struct workloadMap map;                     /* The binary workload */
+    int sorted = 0;            /* Are the processes in order of arrival? */
+    double start = Now();                    /* Start of the phase */
+    const char *phase = "load";                 /* The phase measured */
+    
+    switch (MapWorkload(fileName, &map)) {
+        case 1:
+            /* The columns of the binary workload are copied whole into the columns of the workload */
+            AddProcessColumns(workload, (int)map.count, map.pID, map.arrivalTime, map.cpuBurst, map.priority, map.deadline);
+            *quantum = map.quantum;
+            sorted = map.sorted;
+            UnmapWorkload(&map);
+            
+            /* The flag of the file is not trusted: a single pass finds the arrivals out of order */
+            for (int i = 1; i < workload->count && sorted; i++)
+                if (workload->arrivalTime[i] < workload->arrivalTime[i - 1])
+                    sorted = 0;
+            break;
+            
+        case 0:
+            if (ReadTextWorkload(fileName, workload, quantum) == EXIT_FAILURE) {
+                FreeProcessList(workload);
+                return (EXIT_FAILURE);
+            }
+            phase = "parse";
+            break;
+            
+        default:
+            return (EXIT_FAILURE);
+    }
+    
+    if (stats)
+        AddPhase(stats, phase, Now() - start);
+    
+    /* Start by sorting the processes by arrival time */
+    if (!sorted) {
+        start = Now();
+        SortProcessList(workload, ARRIVALTIME);
+        if (stats)
+            AddPhase(stats, "sort", Now() - start);
+    }
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunReport                                                  */
+/*                                                                       */
+/*  Purpose: Runs one algorithm in it's own simulation context, over the */
+/*           shared workload, keeping the results in a temporal file     */
+/*           until they can be printed in order. It is a task of the     */
+/*           pool of threads                                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The parallel run and the algorithm               */
+/*                                                                       */
+/*            Output:   The report of the algorithm, or NULL if the      */
+/*                      temporal file could not be created               */
+/*                                                                       */
+/*************************************************************************/
+static void RunReport(void *data, int algorithm){
+    struct parallelRun *run = data;               /* The parallel run */
+    struct simulation simulation;            /* State of the algorithm */
+    FILE *report = tmpfile();               /* Where the results go */
+    struct runMeasure measure;                /* Measures the algorithm */
+    
+    if (report) {
+        OpenSimulation(&simulation, run->workload, report, run->settings->format, run->settings);
+        StartMeasure(&measure, run->settings);
+        Schedule(&simulation, algorithm, run->quantum);
+        MeasureRun(&run->phases[algorithm], algorithm, &measure, &simulation);
+        FreeSimulation(&simulation);
+    }
+    run->reports[algorithm] = report;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PrintReport                                                */
+/*                                                                       */
+/*  Purpose: Copies the report of an algorithm to the standard output    */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The report                                       */
+/*                                                                       */
+/*            Output:   The report is printed and closed                 */
+/*                                                                       */
+/*************************************************************************/
+static void PrintReport(FILE *report){
+    char block[REPORTBLOCK];               /* Part of the report copied */
+    size_t length;                   /* Bytes read in the last block */
+    
+    rewind(report);
+    while ((length = fread(block, 1, sizeof(block), report)) > 0)
+        fwrite(block, 1, length, stdout);
+    fclose(report);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Simulate                                                   */
+/*                                                                       */
+/*  Purpose: Reads all the processes of a file and runs the nine         */
+/*           scheduling algorithms over them. With more than one thread  */
+/*           the algorithms run at the same time, each one in it's own   */
+/*           simulation context, and their results are printed in the    */
+/*           usual order when all of them have finished. The statistics  */
+/*           of every phase are written in the standard error if the     */
+/*           settings ask for them                                       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file, the number of threads and  */
+/*                      the settings                                     */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Simulate(const char *fileName, int threads, const struct settings *settings){
+    struct workload workload = {0};      /* The processes of the file */
+    struct simulation simulation;            /* State of the algorithms */
+    struct parallelRun run = {.workload = &workload, .settings = settings}; /* The algorithms run at the same time */
+    struct stats stats = {.count = 0};            /* The work of every phase */
+    int quantum = 0;                   /* Quantum value for Round Robin */
+    
+    if (LoadWorkload(fileName, &workload, &quantum, &stats) == EXIT_FAILURE)
+        return (EXIT_FAILURE);
+    
+    if (threads > 1) {
+        run.quantum = quantum;
+        RunWorkers(threads, NUMALGORITHMS, RunReport, &run);
+    }
+    
+    /* Print the results of all the scheduling algorithms. An algorithm without a report is run here */
+    OpenSimulation(&simulation, &workload, stdout, settings->format, settings);
+    ReportHeader(&simulation.report);
+    for (int algorithm = 0; algorithm < NUMALGORITHMS; algorithm++) {
+        struct phaseStats *phase = AddPhase(&stats, AlgorithmName(algorithm), 0.0); /* The work of the algorithm */
+        struct runMeasure measure;            /* Measures the algorithm */
         
+        if (run.reports[algorithm]) {
+            FlushReport(&simulation.report);
+            PrintReport(run.reports[algorithm]);
+            if (phase)
+                *phase = run.phases[algorithm];
+        }
         else {
-            
-            /* The first number in the file is the quantum */
-            quantum = GetInt(fp);
+            StartMeasure(&measure, settings);
+            Schedule(&simulation, algorithm, quantum);
+            MeasureRun(phase, algorithm, &measure, &simulation);
+        }
+    }
+    FreeSimulation(&simulation);
+    
+    FreeProcessList(&workload);
+    
+    if (settings->stats)
+        WriteStats(&stats, stderr);
+    if (settings->profile)
+        WriteProfile(&stats, stderr);
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ParseQuanta                                                */
+/*                                                                       */
+/*  Purpose: Reads a list of quanta separated by commas. Every item is   */
+/*           a quantum, or a range "first-last" with an optional step    */
+/*           after a colon, as in "1-20", "10-100:10" or "1,2,4,8"       */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The list, the most quanta accepted, and where to */
+/*                      store the quanta and how many they are           */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE if the list is     */
+/*                      wrong, a quantum is not positive or there are    */
+/*                      too many quanta                                  */
+/*                                                                       */
+/*************************************************************************/
+static int ParseQuanta(const char *list, int maximum, int **quanta, int *count){
+    int capacity = 0;                     /* Quanta that fit in the array */
+    int valid;                       /* Was the last item read correct? */
+    const char *c = list;                  /* Next character of the list */
+    
+    *quanta = NULL;
+    *count = 0;
+    
+    do {
+        char *end;                       /* End of the last number read */
+        long first, last, step = 1;             /* The range of the item */
         
-            if (quantum == EXIT_FAILURE)
-                ErrorMsg("'main'","The quantum was not found");
+        valid = 0;
+        first = last = strtol(c, &end, 10);
+        if (end == c)
+            break;
+        c = end;
+        if (*c == '-') {
+            last = strtol(++c, &end, 10);
+            if (end == c)
+                break;
+            c = end;
+            if (*c == ':') {
+                step = strtol(++c, &end, 10);
+                if (end == c)
+                    break;
+                c = end;
+            }
+        }
+        if (first < 1 || last < first || last > INT_MAX || step < 1)
+            break;
+        
+        /* The range is refused before it is expanded */
+        if ((last - first) / step >= maximum - *count) {
+            char message[64];                 /* The message with the maximum */
             
-            else {
-                /* Read the process information until the end of file 
-                is reached */
-                while (!feof(fp)){
-                    
-                    /* For every four parameters create a new process */
-                    for (i = 0; ((i < NUMVAL) && (!feof(fp))); i++) {
-                        parameters[i] = GetInt(fp);
-                    }
-                    
-                    /* Do we have only four parameters? */
-                    if (i == NUMVAL) {
-                        
-                        /* Create a new process with its information */
-                        CreateProcessList(parameters[0], parameters[1], parameters[2], parameters[3]);
-                    }
+            snprintf(message, sizeof(message), "There can not be more than %d quanta", maximum);
+            ErrorMsg("'main'", message);
+            free(*quanta);
+            *quanta = NULL;
+            return (EXIT_FAILURE);
+        }
+        
+        for (long quantum = first; quantum <= last; quantum += step) {
+            if (*count == capacity) {
+                int *grown = realloc(*quanta, (size_t)(capacity ? capacity * 2 : 16) * sizeof(int));
+                if (!grown) {
+                    ErrorMsg("'main'", "Not enough memory for the quanta");
+                    exit(EXIT_FAILURE);
                 }
+                *quanta = grown;
+                capacity = capacity ? capacity * 2 : 16;
+            }
+            (*quanta)[(*count)++] = (int)quantum;
+        }
+        valid = 1;
+    } while (*c++ == ',');
+    
+    if (!valid || c[-1] != '\0') {
+        free(*quanta);
+        *quanta = NULL;
+        ErrorMsg("'main'", "The quanta must be positive numbers or ranges, as in 1-20:2,25,30");
+        return (EXIT_FAILURE);
+    }
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunQuantum                                                 */
+/*                                                                       */
+/*  Purpose: Runs Round Robin with one of the quanta of a sweep, in it's */
+/*           own simulation context and without printing. It is a task   */
+/*           of the pool of threads                                      */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The sweep and the position of the quantum        */
+/*                                                                       */
+/*            Output:   The results for the quantum                      */
+/*                                                                       */
+/*************************************************************************/
+static void RunQuantum(void *data, int task){
+    struct quantumSweep *sweep = data;                     /* The sweep */
+    struct simulation simulation;            /* State of the algorithm */
+    
+    OpenSimulation(&simulation, sweep->workload, stdout, NOREPORT, sweep->settings);
+    Schedule(&simulation, ROUNDROBIN, sweep->quanta[task]);
+    sweep->results[task] = simulation.result;
+    FreeSimulation(&simulation);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Sweep                                                      */
+/*                                                                       */
+/*  Purpose: Evaluates Round Robin with many quanta over the processes   */
+/*           of a file, which is read and sorted only once. The quanta   */
+/*           run at the same time, and a table with the average waiting  */
+/*           time, the average turnaround time and the number of context */
+/*           switches for every quantum is printed at the end, with the  */
+/*           time spent on the switches if they cost time                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the file, the list of quanta, the    */
+/*                      number of threads and the settings               */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Sweep(const char *fileName, const char *list, int threads, const struct settings *settings){
+    struct workload workload = {0};      /* The processes of the file */
+    struct quantumSweep sweep = {.workload = &workload, .settings = settings}; /* The quanta run at the same time */
+    int *quanta;                               /* The quanta to evaluate */
+    int count;                                     /* How many they are */
+    int quantum;            /* The quantum of the file, which is not used */
+    int costs = settings->costs.context > 0 || settings->costs.migration > 0; /* Show the overhead? */
+    
+    if (ParseQuanta(list, MAXSWEEP, &quanta, &count) == EXIT_FAILURE)
+        return (EXIT_FAILURE);
+    
+    sweep.results = malloc((size_t)count * sizeof(struct simulationResult));
+    if (!sweep.results) {
+        ErrorMsg("'main'", "Not enough memory for the results");
+        free(quanta);
+        return (EXIT_FAILURE);
+    }
+    
+    if (LoadWorkload(fileName, &workload, &quantum, NULL) == EXIT_FAILURE) {
+        free(sweep.results);
+        free(quanta);
+        return (EXIT_FAILURE);
+    }
+    
+    sweep.quanta = quanta;
+    RunWorkers(threads, count, RunQuantum, &sweep);
+    
+    printf(" ------------------------------------------------------------------%s\n", costs ? "---------------" : "");
+    printf("|  Quantum  |  Average Wait  |  Average Turnaround  |  Switches    |%s\n", costs ? "  Overhead    |" : "");
+    printf(" ------------------------------------------------------------------%s\n", costs ? "---------------" : "");
+    for (int i = 0; i < count; i++) {
+        long long processes = sweep.results[i].processes;  /* Processes that finished */
+        
+        printf("| %9d | %14.2f | %20.2f | %12lld |", quanta[i],
+               processes > 0 ? (double)sweep.results[i].totalWaitTime / processes : 0.0,
+               processes > 0 ? (double)sweep.results[i].totalTurnaround / processes : 0.0,
+               sweep.results[i].contextSwitches);
+        if (costs)
+            printf(" %12lld |", sweep.results[i].overhead);
+        printf("\n");
+    }
+    printf(" ------------------------------------------------------------------%s\n", costs ? "---------------" : "");
+    
+    FreeProcessList(&workload);
+    free(sweep.results);
+    free(quanta);
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Trace                                                      */
+/*                                                                       */
+/*  Purpose: Runs one algorithm over the processes of a file, writing    */
+/*           every slice of time of the CPU to a binary trace, besides   */
+/*           the usual report                                            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the algorithm, the name of the file  */
+/*                      of processes, the name of the trace and the      */
+/*                      settings                                         */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Trace(const char *algorithmName, const char *fileName, const char *traceName, const struct settings *settings){
+    struct workload workload = {0};      /* The processes of the file */
+    struct simulation simulation;            /* State of the algorithm */
+    struct traceWriter trace;                     /* Gantt chart of the CPU */
+    int algorithm = FindAlgorithm(algorithmName); /* The algorithm to run */
+    int quantum = 0;                   /* Quantum value for Round Robin */
+    
+    if (algorithm == -1 || LoadWorkload(fileName, &workload, &quantum, NULL) == EXIT_FAILURE)
+        return (EXIT_FAILURE);
+    
+    if (OpenTrace(&trace, traceName, algorithm, quantum, settings->machine.cpus) == EXIT_FAILURE) {
+        FreeProcessList(&workload);
+        return (EXIT_FAILURE);
+    }
+    
+    OpenSimulation(&simulation, &workload, stdout, settings->format, settings);
+    simulation.trace = &trace;
+    ReportHeader(&simulation.report);
+    Schedule(&simulation, algorithm, quantum);
+    FreeSimulation(&simulation);
+    
+    FreeProcessList(&workload);
+    
+    return CloseTrace(&trace);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Generate                                                   */
+/*                                                                       */
+/*  Purpose: Writes a synthetic workload as text in the standard output  */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The options of the generator, as "name=value"    */
+/*                      and how many they are                            */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Generate(const char *options[], int count){
+    struct generator generator;               /* Creates the processes */
+    
+    InitGenerator(&generator);
+    for (int i = 0; i < count; i++)
+        if (SetGeneratorOption(&generator, options[i]) == EXIT_FAILURE)
+            return (EXIT_FAILURE);
+    
+    return WriteGeneratedWorkload(&generator, stdout);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PeakMemory                                                 */
+/*                                                                       */
+/*  Purpose: Obtains the most memory that the program has had resident   */
+/*           at the same time                                            */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   None                                             */
+/*                                                                       */
+/*            Output:   The peak resident memory in MiB                  */
+/*                                                                       */
+/*************************************************************************/
+static double PeakMemory(){
+    struct rusage usage;                    /* Resources used so far */
+    
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return (double)usage.ru_maxrss / (1024.0 * 1024.0);      /* In bytes */
+#else
+    return (double)usage.ru_maxrss / 1024.0;             /* In kilobytes */
+#endif
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PrintMeasure                                               */
+/*                                                                       */
+/*  Purpose: Prints one row of the benchmark                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The number of processes, the phase and the time  */
+/*                      it took in seconds                               */
+/*                                                                       */
+/*            Output:   The row, with the time per process, the          */
+/*                      processes per second and the peak memory         */
+/*                                                                       */
+/*************************************************************************/
+static void PrintMeasure(long long processes, const char *phase, double seconds){
+    printf("| %10lld | %-9s | %10.4f | %10.1f | %14.0f | %9.1f |\n", processes, phase, seconds,
+           seconds * 1e9 / (double)processes, seconds > 0 ? (double)processes / seconds : 0.0, PeakMemory());
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Benchmark                                                  */
+/*                                                                       */
+/*  Purpose: Measures the parsing, the sorting and every algorithm with  */
+/*           synthetic workloads of a thousand processes, then ten times */
+/*           more each time, up to a maximum. Every workload is written  */
+/*           to a temporal text file, which is then read as usual. The   */
+/*           algorithms run one after the other without printing         */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The options of the generator, as "name=value",   */
+/*                      plus "max=" for the biggest workload, how many   */
+/*                      they are and the settings                        */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Benchmark(const char *options[], int count, const struct settings *settings){
+    struct generator generator;               /* Creates the processes */
+    long long maximum = BENCHMARKMAX;          /* The biggest workload */
+    char fileName[] = "/tmp/scheduleXXXXXX";   /* The temporal workload */
+    int status = EXIT_SUCCESS;               /* Result of the benchmark */
+    
+    InitGenerator(&generator);
+    for (int i = 0; i < count; i++) {
+        if (strncmp(options[i], "max=", 4) == 0) {
+            char *end;                      /* End of the number read */
+            
+            maximum = strtoll(options[i] + 4, &end, 10);
+            if (end == options[i] + 4 || *end != '\0' || maximum < BENCHMARKSIZE || maximum > INT_MAX) {
+                char message[80];          /* The message with the limits */
                 
-                /* Start by sorting the processes by arrival time */
-                SortProcessList(ARRIVALTIME);
-                
-                /* Apply all the scheduling algorithms and print the results */
-                 FirstComeFS();
-                 NonPreemptive(CPUBURST);
-                 NonPreemptive(PRIORITY);
-                 Preemptive(CPUBURST);
-                 Preemptive(PRIORITY);
-                 RoundRobin(quantum);
-                
+                snprintf(message, sizeof(message), "The value of max must be a number from %d to %d", BENCHMARKSIZE, INT_MAX);
+                ErrorMsg("'Benchmark'", message);
+                return (EXIT_FAILURE);
             }
         }
+        else if (SetGeneratorOption(&generator, options[i]) == EXIT_FAILURE)
+            return (EXIT_FAILURE);
+    }
+    
+    printf(" ------------------------------------------------------------------------------\n");
+    printf("|  Processes | Phase     |    Seconds | ns/process |  Processes/s   |  Peak MiB |\n");
+    printf(" ------------------------------------------------------------------------------\n");
+    
+    for (long long size = BENCHMARKSIZE; size <= maximum && status == EXIT_SUCCESS; size *= 10) {
+        struct workload workload = {0};          /* The processes read */
+        struct simulation simulation;        /* State of the algorithms */
+        int quantum;                   /* Quantum value for Round Robin */
+        double start;                         /* Start of the phase */
+        int fd = mkstemp(fileName);       /* The temporal workload */
+        FILE *fp = fd == -1 ? NULL : fdopen(fd, "w");
+        
+        if (!fp) {
+            ErrorMsg("'Benchmark'", "The temporal workload can not be created");
+            return (EXIT_FAILURE);
+        }
+        generator.count = size;
+        status = WriteGeneratedWorkload(&generator, fp);
+        if (fclose(fp) != 0 || status == EXIT_FAILURE) {
+            ErrorMsg("'Benchmark'", "The temporal workload can not be written");
+            status = EXIT_FAILURE;
+        }
         
+        if (status == EXIT_SUCCESS) {
+            start = Now();
+            status = ReadTextWorkload(fileName, &workload, &quantum);
+            PrintMeasure(size, "parse", Now() - start);
+        }
+        remove(fileName);
+        memcpy(fileName + sizeof(fileName) - 7, "XXXXXX", 6);
+        
+        if (status == EXIT_SUCCESS) {
+            start = Now();
+            SortProcessList(&workload, ARRIVALTIME);
+            PrintMeasure(size, "sort", Now() - start);
+            
+            OpenSimulation(&simulation, &workload, stdout, NOREPORT, settings);
+            for (int algorithm = 0; algorithm < NUMALGORITHMS; algorithm++) {
+                start = Now();
+                Schedule(&simulation, algorithm, quantum);
+                PrintMeasure(size, AlgorithmName(algorithm), Now() - start);
+            }
+            FreeSimulation(&simulation);
+            printf(" ------------------------------------------------------------------------------\n");
+        }
+        FreeProcessList(&workload);
+        fflush(stdout);
+    }
+    
+    return status;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Convert                                                    */
+/*                                                                       */
+/*  Purpose: Converts a text workload to the binary format, with the     */
+/*           processes already sorted by arrival time, so the next runs  */
+/*           do not need to parse nor sort it. The deadlines are written */
+/*           as a fifth column if any process has one. The binary format */
+/*           has no I/O cycles, so the workloads with them are refused   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The names of the text file and the binary file   */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int Convert(const char *textName, const char *binaryName){
+    static const int fields[NUMVAL + 1] = {PID, ARRIVALTIME, CPUBURST, PRIORITY, DEADLINE}; /* The columns, in order */
+    struct workload workload = {0};      /* The processes of the file */
+    int quantum = 0;                   /* Quantum value for Round Robin */
+    int columns = NUMVAL;                     /* Columns to be written */
+    int status = EXIT_SUCCESS;                 /* Result of the writing */
+    FILE *fp;                                   /* The binary workload */
+    
+    if (ReadTextWorkload(textName, &workload, &quantum) == EXIT_FAILURE) {
+        FreeProcessList(&workload);
+        return (EXIT_FAILURE);
+    }
+    if (workload.cycleCount > 0) {
+        ErrorMsg("'main'", "The I/O cycles can not be written to a binary workload");
+        FreeProcessList(&workload);
+        return (EXIT_FAILURE);
     }
-}
\ No newline at end of file
+    SortProcessList(&workload, ARRIVALTIME);
+    for (int i = 0; i < workload.count && columns == NUMVAL; i++)
+        if (workload.deadline[i] != NODEADLINE)
+            columns = NUMVAL + 1;
+    
+    fp = CreateWorkload(binaryName, quantum, WORKLOADSORTED | (columns > NUMVAL ? WORKLOADDEADLINES : 0), workload.count);
+    if (!fp)
+        status = EXIT_FAILURE;
+    
+    /* The columns of the workload are written as they are */
+    for (int f = 0; f < columns && status == EXIT_SUCCESS; f++)
+        status = WriteWorkloadColumn(fp, ProcessColumn(&workload, fields[f]), workload.count);
+    
+    if (fp && fclose(fp) != 0)
+        status = EXIT_FAILURE;
+    if (status == EXIT_FAILURE)
+        ErrorMsg("'main'", "The binary workload can not be written");
+    
+    FreeProcessList(&workload);
+    
+    return status;
+}
+
+/*************************************************************************/
+/*                            Main entry point                           */
+/*************************************************************************/
+
+int main (int argc, const char * argv[]) {
+    struct settings settings = {.format = BOXES, .machine = {.cpus = 1, .policy = GLOBALQUEUE, .devices = 1},
+                                .feedback = {.levels = DEFAULTLEVELS, .boost = -1}}; /* How the simulations are done */
+    
+    /* The format of the reports, the CPUs and the levels can be chosen before the rest of the parameters */
+    while (argc > 1 && strncmp(argv[1], "--", 2) == 0) {
+        if (ReportFormat(argv[1] + 2) != -1)
+            settings.format = ReportFormat(argv[1] + 2);
+        else if (strncmp(argv[1], "--cpus=", 7) == 0) {
+            settings.machine.cpus = atoi(argv[1] + 7);
+            if (settings.machine.cpus < 1 || settings.machine.cpus > MAXCPUS) {
+                ErrorMsg("'main'", "The number of CPUs must be between 1 and 4096");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--devices=", 10) == 0) {
+            settings.machine.devices = atoi(argv[1] + 10);
+            if (settings.machine.devices < 1 || settings.machine.devices > MAXDEVICES) {
+                ErrorMsg("'main'", "The number of devices must be between 1 and 4096");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--policy=", 9) == 0) {
+            settings.machine.policy = DispatchPolicy(argv[1] + 9);
+            if (settings.machine.policy == -1) {
+                ErrorMsg("'main'", "Unknown policy, use global or steal");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--levels=", 9) == 0) {
+            settings.feedback.levels = atoi(argv[1] + 9);
+            if (settings.feedback.levels < 1 || settings.feedback.levels > MAXLEVELS) {
+                ErrorMsg("'main'", "The number of levels must be between 1 and 64");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--quanta=", 9) == 0) {
+            int *quanta, count;                  /* The quanta of the levels */
+            
+            if (ParseQuanta(argv[1] + 9, MAXLEVELS, &quanta, &count) == EXIT_FAILURE)
+                return (EXIT_FAILURE);
+            for (int level = 0; level < count; level++)
+                settings.feedback.quanta[level] = quanta[level];
+            settings.feedback.levels = count;
+            free(quanta);
+        }
+        else if (strncmp(argv[1], "--boost=", 8) == 0) {
+            settings.feedback.boost = atoll(argv[1] + 8);
+            if (settings.feedback.boost < 0) {
+                ErrorMsg("'main'", "The time between boosts can not be negative");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--deadlines=", 12) == 0) {
+            if (strcmp(argv[1] + 12, "absolute") == 0)
+                settings.deadlines = ABSOLUTEDEADLINES;
+            else if (strcmp(argv[1] + 12, "relative") == 0)
+                settings.deadlines = RELATIVEDEADLINES;
+            else {
+                ErrorMsg("'main'", "Unknown deadlines, use absolute or relative");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--switch-cost=", 14) == 0 || strncmp(argv[1], "--migration-cost=", 17) == 0) {
+            long long *cost = argv[1][2] == 's' ? &settings.costs.context : &settings.costs.migration; /* The cost given */
+            
+            *cost = atoll(strchr(argv[1], '=') + 1);
+            if (*cost < 0) {
+                ErrorMsg("'main'", "The cost of a switch can not be negative");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strcmp(argv[1], "--percentiles") == 0)
+            settings.percentiles = 1;
+        else if (strcmp(argv[1], "--stats") == 0)
+            settings.stats = 1;
+        else if (strcmp(argv[1], "--profile") == 0) {
+            struct hardwareCounters counters;      /* Tells if any can be used */
+            
+            settings.profile = OpenCounters(&counters) > 0;
+            CloseCounters(&counters);
+            if (!settings.profile)
+                fprintf(stderr, "The hardware counters are not available, the profile is not written\n");
+        }
+        else if (strncmp(argv[1], "--latency=", 10) == 0) {
+            settings.fairness.latency = atoll(argv[1] + 10);
+            if (settings.fairness.latency < 1) {
+                ErrorMsg("'main'", "The target latency must be positive");
+                return (EXIT_FAILURE);
+            }
+        }
+        else if (strncmp(argv[1], "--granularity=", 14) == 0) {
+            settings.fairness.granularity = atoll(argv[1] + 14);
+            if (settings.fairness.granularity < 1) {
+                ErrorMsg("'main'", "The minimum granularity must be positive");
+                return (EXIT_FAILURE);
+            }
+        }
+        else
+            break;
+        argv++;
+        argc--;
+    }
+    
+    /* Check if the parameters in the main function are not empty */
+    if (argc < NUMPARAMS){
+        printf("Need a file with the process information\n\n");
+        printf("Abnormal termination\n");
+        return (EXIT_FAILURE);
+    }
+    
+    /* A text workload can be converted to the binary format */
+    if (strcmp(argv[1], "--convert") == 0) {
+        if (argc < NUMPARAMS + 2) {
+            printf("Need the text file and the binary file\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return Convert(argv[2], argv[3]);
+    }
+    
+    /* In the streaming mode, the processes are read while they are scheduled */
+    if (strcmp(argv[1], "--stream") == 0) {
+        if (argc < NUMPARAMS + 1) {
+            printf("Need the algorithm to stream\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return Stream(argv[2], argc > NUMPARAMS + 1 ? argv[3] : "-", &settings);
+    }
+    
+    /* The slices of the CPU can be written to a binary trace, which is read later */
+    if (strcmp(argv[1], "--trace") == 0) {
+        if (argc < NUMPARAMS + 3) {
+            printf("Need the algorithm, the file with the process information and the trace\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return Trace(argv[2], argv[3], argv[4], &settings);
+    }
+    if (strcmp(argv[1], "--read-trace") == 0) {
+        if (argc < NUMPARAMS + 1) {
+            printf("Need the trace\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return ReadTrace(argv[2], argc > NUMPARAMS + 1 && strcmp(argv[3], "decode") == 0);
+    }
+    
+    /* Synthetic workloads can be generated, and used to measure the simulator */
+    if (strcmp(argv[1], "--generate") == 0)
+        return Generate(argv + 2, argc - 2);
+    if (strcmp(argv[1], "--bench") == 0)
+        return Benchmark(argv + 2, argc - 2, &settings);
+    
+    /* Round Robin can be evaluated with many quanta at the same time */
+    if (strcmp(argv[1], "--sweep") == 0) {
+        if (argc < NUMPARAMS + 2) {
+            printf("Need a file with the process information and the quanta\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return Sweep(argv[2], argv[3], argc > NUMPARAMS + 2 ? atoi(argv[4]) : NumberOfCPUs(), &settings);
+    }
+    
+    /* The algorithms can run at the same time, one per processor */
+    if (strcmp(argv[1], "--parallel") == 0) {
+        if (argc < NUMPARAMS + 1) {
+            printf("Need a file with the process information\n\n");
+            printf("Abnormal termination\n");
+            return (EXIT_FAILURE);
+        }
+        return Simulate(argv[2], argc > NUMPARAMS + 1 ? atoi(argv[3]) : NumberOfCPUs(), &settings);
+    }
+    
+    return Simulate(argv[1], 1, &settings);
+}
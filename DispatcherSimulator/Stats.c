@@ -0,0 +1,332 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Stats.c                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Time and counters of every phase of the simulator, to find   */
+/*          which part is slow, and the hardware counters of the CPU     */
+/*                                                                       */
+/* References:                                                           */
+/*          perf_event_open(2) of Linux                                  */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          The phases must be added by one thread at a time             */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 23:59 2026 - File created. The monotonic clock was   */
+/*                               in Scheduler.c                          */
+/*                                                                       */
+/*          Oct  17 23:59 2026 - The cycles, instructions, cache misses  */
+/*                               and branch misses of the algorithms     */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          The phases after the last one that fits are not kept. A      */
+/*          hardware counter that can not be opened, because the system  */
+/*          is not Linux, the CPU has no such event or the user is not   */
+/*          allowed to count it, reads as -1 and is written empty        */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The statistics are written as CSV lines that start with      */
+/*          "stats", so they can be found among other messages, and the  */
+/*          hardware counters as lines that start with "profile". The    */
+/*          counters only count the calling thread in user mode, which   */
+/*          is allowed by the default perf_event_paranoid of 2. When the */
+/*          CPU multiplexes them, their values are scaled to the whole   */
+/*          time they were enabled                                       */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                      /* Used for the function fprintf */
+#include <string.h>                       /* Used for the function memset */
+#include <time.h>                  /* Used for the function clock_gettime */
+#ifdef __linux__
+#include <unistd.h>                /* Used for the functions syscall and read */
+#include <sys/ioctl.h>                        /* Used for the function ioctl */
+#include <sys/syscall.h>          /* Used for the system call perf_event_open */
+#include <linux/perf_event.h>        /* Used for the hardware counters */
+#endif
+#include "Stats.h"                                     /* Function header */
+
+#ifdef __linux__
+static const unsigned long long hardwareEvents[NUMHARDWARE] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+#endif
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Now                                                        */
+/*                                                                       */
+/*  Purpose: Reads a monotonic clock, which is not changed when the time */
+/*           of the system is adjusted                                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   None                                             */
+/*                                                                       */
+/*            Output:   The time in seconds                              */
+/*                                                                       */
+/*************************************************************************/
+double Now(){
+    struct timespec now;                            /* The current time */
+    
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: AddPhase                                                   */
+/*                                                                       */
+/*  Purpose: Adds a phase to the statistics, with it's counters in zero  */
+/*           and it's hardware counters unknown                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The statistics, the name of the phase, which     */
+/*                      must live as long as them, and it's time         */
+/*                                                                       */
+/*            Output:   The phase, where the counters are stored, or     */
+/*                      NULL if there is no room for it                  */
+/*                                                                       */
+/*************************************************************************/
+struct phaseStats *AddPhase(struct stats *stats, const char *name, double seconds){
+    struct phaseStats *phase;                         /* The new phase */
+    
+    if (stats->count == MAXPHASES)
+        return NULL;
+    
+    phase = &stats->phases[stats->count++];
+    memset(phase, 0, sizeof(*phase));
+    phase->name = name;
+    phase->seconds = seconds;
+    for (int event = 0; event < NUMHARDWARE; event++)
+        phase->hardware[event] = -1;
+    
+    return phase;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteStats                                                 */
+/*                                                                       */
+/*  Purpose: Writes the time and the counters of every phase, and their  */
+/*           total, as CSV lines after a line with the names of the      */
+/*           columns                                                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The statistics and the file                      */
+/*                                                                       */
+/*            Output:   The statistics in the file                       */
+/*                                                                       */
+/*************************************************************************/
+void WriteStats(const struct stats *stats, FILE *out){
+    struct phaseStats total = {.name = "total"};     /* All the phases */
+    
+    fprintf(out, "stats,phase,seconds,write_seconds,comparisons,swaps,events,context_switches,bytes\n");
+    for (int i = 0; i <= stats->count; i++) {
+        const struct phaseStats *phase = i < stats->count ? &stats->phases[i] : &total;
+        
+        fprintf(out, "stats,%s,%.6f,%.6f,%lld,%lld,%lld,%lld,%lld\n", phase->name, phase->seconds, phase->writing,
+                phase->comparisons, phase->swaps, phase->events, phase->switches, phase->bytes);
+        if (i < stats->count) {
+            total.seconds += phase->seconds;
+            total.writing += phase->writing;
+            total.comparisons += phase->comparisons;
+            total.swaps += phase->swaps;
+            total.events += phase->events;
+            total.switches += phase->switches;
+            total.bytes += phase->bytes;
+        }
+    }
+    fflush(out);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenCounters                                               */
+/*                                                                       */
+/*  Purpose: Opens the hardware counters of the calling thread, stopped. */
+/*           Every counter is opened on it's own, so the ones the CPU or */
+/*           the system do not allow are left closed                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The counters                                     */
+/*                                                                       */
+/*            Output:   The number of counters opened                    */
+/*                                                                       */
+/*************************************************************************/
+int OpenCounters(struct hardwareCounters *counters){
+    int opened = 0;                         /* Counters that are open */
+#ifdef __linux__
+    struct perf_event_attr attributes;      /* What is counted, and how */
+#endif
+    
+    for (int event = 0; event < NUMHARDWARE; event++) {
+        counters->fds[event] = -1;
+#ifdef __linux__
+        memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = hardwareEvents[event];
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        counters->fds[event] = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+        if (counters->fds[event] >= 0)
+            opened++;
+        else
+            counters->fds[event] = -1;
+#endif
+    }
+    
+    return opened;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StartCounters                                              */
+/*                                                                       */
+/*  Purpose: Sets the open hardware counters to zero and starts them     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The counters                                     */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void StartCounters(const struct hardwareCounters *counters){
+#ifdef __linux__
+    for (int event = 0; event < NUMHARDWARE; event++)
+        if (counters->fds[event] >= 0) {
+            ioctl(counters->fds[event], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->fds[event], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#else
+    (void)counters;
+#endif
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: StopCounters                                               */
+/*                                                                       */
+/*  Purpose: Stops the hardware counters and reads them, scaled to the   */
+/*           time they were enabled if the CPU had to multiplex them     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The counters and where to store their values,    */
+/*                      one per hardwareEvents                           */
+/*                                                                       */
+/*            Output:   The values, -1 for the counters that are closed  */
+/*                      or never ran                                     */
+/*                                                                       */
+/*************************************************************************/
+void StopCounters(const struct hardwareCounters *counters, long long values[]){
+#ifdef __linux__
+    unsigned long long count[3];         /* Value, time enabled and running */
+#else
+    (void)counters;
+#endif
+    
+    for (int event = 0; event < NUMHARDWARE; event++) {
+        values[event] = -1;
+#ifdef __linux__
+        if (counters->fds[event] < 0)
+            continue;
+        ioctl(counters->fds[event], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counters->fds[event], count, sizeof(count)) != (ssize_t)sizeof(count) || count[2] == 0)
+            continue;
+        values[event] = (long long)(count[2] < count[1] ? (double)count[0] * ((double)count[1] / (double)count[2]) :
+                                    (double)count[0]);
+#endif
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CloseCounters                                              */
+/*                                                                       */
+/*  Purpose: Closes the hardware counters                                */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The counters                                     */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void CloseCounters(struct hardwareCounters *counters){
+    for (int event = 0; event < NUMHARDWARE; event++) {
+#ifdef __linux__
+        if (counters->fds[event] >= 0)
+            close(counters->fds[event]);
+#endif
+        counters->fds[event] = -1;
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: PutCount                                                   */
+/*                                                                       */
+/*  Purpose: Writes a field of the profile, which is empty when it's     */
+/*           hardware counter is unknown                                 */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The file, the counter and what it is divided by, */
+/*                      or 0 to write the counter itself                 */
+/*                                                                       */
+/*            Output:   The field, after a comma                         */
+/*                                                                       */
+/*************************************************************************/
+static void PutCount(FILE *out, long long count, long long divisor){
+    if (count < 0 || divisor < 0)
+        fputs(",", out);
+    else if (divisor == 0)
+        fprintf(out, ",%lld", count);
+    else
+        fprintf(out, ",%.4f", (double)count / (double)divisor);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteProfile                                               */
+/*                                                                       */
+/*  Purpose: Writes the hardware counters of every phase that has any,   */
+/*           with the instructions per cycle and the misses per process  */
+/*           finished, as CSV lines after a line with the names of the   */
+/*           columns                                                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The statistics and the file                      */
+/*                                                                       */
+/*            Output:   The profile in the file                          */
+/*                                                                       */
+/*************************************************************************/
+void WriteProfile(const struct stats *stats, FILE *out){
+    fprintf(out, "profile,phase,processes,cycles,instructions,ipc,cache_misses,branch_misses,"
+            "cache_misses_per_process,branch_misses_per_process\n");
+    for (int i = 0; i < stats->count; i++) {
+        const struct phaseStats *phase = &stats->phases[i];       /* The phase */
+        const long long *hardware = phase->hardware;        /* It's counters */
+        long long processes = phase->processes > 0 ? phase->processes : -1;  /* Divides the misses */
+        
+        if (hardware[HWCYCLES] < 0 && hardware[HWINSTRUCTIONS] < 0 && hardware[HWCACHEMISSES] < 0 &&
+            hardware[HWBRANCHMISSES] < 0)
+            continue;
+        
+        fprintf(out, "profile,%s,%lld", phase->name, phase->processes);
+        PutCount(out, hardware[HWCYCLES], 0);
+        PutCount(out, hardware[HWINSTRUCTIONS], 0);
+        PutCount(out, hardware[HWINSTRUCTIONS], hardware[HWCYCLES] > 0 ? hardware[HWCYCLES] : -1);
+        PutCount(out, hardware[HWCACHEMISSES], 0);
+        PutCount(out, hardware[HWBRANCHMISSES], 0);
+        PutCount(out, hardware[HWCACHEMISSES], processes);
+        PutCount(out, hardware[HWBRANCHMISSES], processes);
+        fputs("\n", out);
+    }
+    fflush(out);
+}
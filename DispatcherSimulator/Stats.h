@@ -0,0 +1,74 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Stats.h                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Time and counters of every phase of the simulator, to find   */
+/*          which part is slow, and the hardware counters of the CPU     */
+/*                                                                       */
+/* References:                                                           */
+/*          perf_event_open(2) of Linux                                  */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          Must be included after stdio.h                               */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 23:59 2026 -- File created                           */
+/*                                                                       */
+/*          Oct  17 23:59 2026 -- Hardware counters of the algorithms    */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          The phases after the last one that fits are not kept. A      */
+/*          hardware counter that can not be opened reads as -1          */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The counters are kept by the queues, the algorithms and the  */
+/*          reports all the time, with one addition each, and the phases */
+/*          only gather them                                             */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+#define MAXPHASES 32                      /* The most phases measured */
+
+enum hardwareEvents {HWCYCLES = 0, HWINSTRUCTIONS, HWCACHEMISSES, HWBRANCHMISSES, NUMHARDWARE};
+
+struct phaseStats{
+    const char *name;      /* parse, load, sort or the algorithm name */
+    double seconds;                      /* Time the phase took */
+    double writing;      /* Part of it spent writing the report */
+    long long comparisons;  /* Comparisons in the ready queues */
+    long long swaps;         /* Entries moved in the ready queues */
+    long long events;      /* Iterations of the loop of the algorithm */
+    long long switches;                  /* Context switches */
+    long long bytes;                   /* Bytes of the report written */
+    long long processes;             /* Processes the algorithm finished */
+    long long hardware[NUMHARDWARE];  /* hardwareEvents, -1 if unknown */
+};
+
+struct hardwareCounters{
+    int fds[NUMHARDWARE];      /* One per hardwareEvents, -1 if closed */
+};
+
+struct stats{
+    struct phaseStats phases[MAXPHASES];       /* The phases in order */
+    int count;                                   /* Phases measured */
+};
+
+double Now();
+struct phaseStats *AddPhase(struct stats *stats, const char *name, double seconds);
+void WriteStats(const struct stats *stats, FILE *out);
+int OpenCounters(struct hardwareCounters *counters);
+void StartCounters(const struct hardwareCounters *counters);
+void StopCounters(const struct hardwareCounters *counters, long long values[]);
+void CloseCounters(struct hardwareCounters *counters);
+void WriteProfile(const struct stats *stats, FILE *out);
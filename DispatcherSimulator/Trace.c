@@ -0,0 +1,304 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Trace.c                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Binary traces with the Gantt chart of a simulation, and the  */
+/*          routines that decode and summarize them                      */
+/*                                                                       */
+/* References:                                                           */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          A trace is read on a machine with the same byte order as the */
+/*          one that wrote it                                            */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 21:00 2026 - File created                            */
+/*                                                                       */
+/*          Oct  17 23:56 2026 - The slices that end blocked for I/O     */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          The errors are reported. A trace that can not be written is  */
+/*          closed with a failure                                        */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The records are gathered in a buffer of eight megabytes that */
+/*          is allocated once, and written with a single system call     */
+/*          every time it fills. The number of records is written in the */
+/*          header when the trace is closed. The reader maps the whole   */
+/*          trace in memory                                              */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdio.h>                        /* Used for the function printf */
+#include <stdlib.h>        /* Used for the memory allocation functions */
+#include <string.h>                       /* Used for the function memcpy */
+#include <fcntl.h>                           /* Used for the function open */
+#include <unistd.h>                         /* Used for the function write */
+#include <sys/mman.h>                         /* Used for the function mmap */
+#include <sys/stat.h>                        /* Used for the function fstat */
+#include "FileIO.h"                     /* Used for the ErrorMsg function */
+#include "Queue.h"               /* Needed by the process definitions */
+#include "Report.h"               /* Used for the names of the algorithms */
+#include "Process.h"                 /* Used for the list of algorithms */
+#include "Trace.h"                                     /* Function header */
+
+#define TRACEBUFFER 1<<23               /* Size of the buffer in bytes */
+
+static const char *reasons[NUMREASONS] = {"finished", "preempted", "expired", "blocked"};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: WriteAll                                                   */
+/*                                                                       */
+/*  Purpose: Writes a block of bytes to a file, even if the system       */
+/*           writes it in parts                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The file, the block and it's size                */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS or EXIT_FAILURE                     */
+/*                                                                       */
+/*************************************************************************/
+static int WriteAll(int fd, const char *block, size_t size){
+    while (size > 0) {
+        ssize_t written = write(fd, block, size);   /* Bytes written */
+        
+        if (written <= 0)
+            return (EXIT_FAILURE);
+        block += written;
+        size -= (size_t)written;
+    }
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: OpenTrace                                                  */
+/*                                                                       */
+/*  Purpose: Creates a trace file and allocates it's buffer              */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The trace, the name of the file, the algorithm,  */
+/*                      the quantum and the number of CPUs               */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE after the error is */
+/*                      reported                                         */
+/*                                                                       */
+/*************************************************************************/
+int OpenTrace(struct traceWriter *trace, const char *fileName, int algorithm, int quantum, int cpus){
+    *trace = (struct traceWriter){
+        .header = {.magic = TRACEMAGIC, .version = TRACEVERSION, .recordSize = sizeof(struct traceRecord),
+                   .algorithm = algorithm, .quantum = quantum, .cpus = cpus}
+    };
+    
+    trace->buffer = malloc(TRACEBUFFER);
+    trace->fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (!trace->buffer || trace->fd < 0) {
+        ErrorMsg("'OpenTrace'", "The trace can not be created");
+        free(trace->buffer);
+        if (trace->fd >= 0)
+            close(trace->fd);
+        return (EXIT_FAILURE);
+    }
+    
+    /* The header goes first, and it is written again when the number of records is known */
+    memcpy(trace->buffer, &trace->header, sizeof(trace->header));
+    trace->length = sizeof(trace->header);
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: AppendRecord                                               */
+/*                                                                       */
+/*  Purpose: Adds a record to the buffer of a trace, writing the buffer  */
+/*           to the file if it is full                                   */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The trace and the record                         */
+/*                                                                       */
+/*            Output:   The trace with one more record                   */
+/*                                                                       */
+/*************************************************************************/
+static void AppendRecord(struct traceWriter *trace, const struct traceRecord *record){
+    if (trace->length + sizeof(*record) > (TRACEBUFFER)) {
+        if (WriteAll(trace->fd, trace->buffer, trace->length) == EXIT_FAILURE)
+            trace->failed = 1;
+        trace->length = 0;
+    }
+    
+    memcpy(trace->buffer + trace->length, record, sizeof(*record));
+    trace->length += sizeof(*record);
+    trace->header.records++;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: TraceSlice                                                 */
+/*                                                                       */
+/*  Purpose: Adds a slice of time that a process spent in a CPU to a     */
+/*           trace. If it continues the last slice of the same process   */
+/*           in the same CPU, both become one record                     */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The trace, the start and the end of the slice,   */
+/*                      the process ID, the CPU and why the process left */
+/*                      the CPU                                          */
+/*                                                                       */
+/*            Output:   The trace with the slice                         */
+/*                                                                       */
+/*************************************************************************/
+void TraceSlice(struct traceWriter *trace, long long start, long long end, int pID, int cpu, int reason){
+    struct traceRecord *pending = &trace->pending;    /* The last slice */
+    
+    if (trace->hasPending && pending->pID == pID && pending->cpu == cpu && pending->end == start) {
+        pending->end = end;
+        pending->reason = (short)reason;
+        return;
+    }
+    
+    if (trace->hasPending)
+        AppendRecord(trace, pending);
+    
+    *pending = (struct traceRecord){.start = start, .end = end, .pID = pID, .cpu = (short)cpu, .reason = (short)reason};
+    trace->hasPending = 1;
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: CloseTrace                                                 */
+/*                                                                       */
+/*  Purpose: Writes the records that are left, and the header with the   */
+/*           final number of records, and closes the trace               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The trace                                        */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE after the error is */
+/*                      reported                                         */
+/*                                                                       */
+/*************************************************************************/
+int CloseTrace(struct traceWriter *trace){
+    if (trace->hasPending)
+        AppendRecord(trace, &trace->pending);
+    trace->hasPending = 0;
+    
+    if (WriteAll(trace->fd, trace->buffer, trace->length) == EXIT_FAILURE ||
+        pwrite(trace->fd, &trace->header, sizeof(trace->header), 0) != (ssize_t)sizeof(trace->header))
+        trace->failed = 1;
+    if (close(trace->fd) != 0)
+        trace->failed = 1;
+    
+    free(trace->buffer);
+    trace->buffer = NULL;
+    
+    if (trace->failed) {
+        ErrorMsg("'CloseTrace'", "The trace could not be written");
+        return (EXIT_FAILURE);
+    }
+    
+    return (EXIT_SUCCESS);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: ReadTrace                                                  */
+/*                                                                       */
+/*  Purpose: Reads a trace and prints every record, or a summary: the    */
+/*           number of records and of finished processes, the first and  */
+/*           last times, the time that every CPU was busy and how many   */
+/*           slices ended for every reason                               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The name of the trace and if the records must be */
+/*                      printed                                          */
+/*                                                                       */
+/*            Output:   EXIT_SUCCESS, or EXIT_FAILURE after the error is */
+/*                      reported                                         */
+/*                                                                       */
+/*************************************************************************/
+int ReadTrace(const char *fileName, int decode){
+    struct traceHeader header;                    /* Header of the trace */
+    const struct traceRecord *records;            /* The mapped records */
+    struct stat status;                         /* The size of the file */
+    long long counts[NUMREASONS] = {0};        /* Slices per reason */
+    long long *busy;                             /* Busy time per CPU */
+    long long first = 0, last = 0;           /* Times of the schedule */
+    void *address;                          /* Where the file is mapped */
+    int fd = open(fileName, O_RDONLY);                /* The trace file */
+    
+    if (fd < 0 || fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(header) ||
+        read(fd, &header, sizeof(header)) != (ssize_t)sizeof(header) || header.magic != TRACEMAGIC) {
+        ErrorMsg("'ReadTrace'", "The file is not a trace");
+        if (fd >= 0)
+            close(fd);
+        return (EXIT_FAILURE);
+    }
+    if (header.version != TRACEVERSION || header.recordSize != sizeof(struct traceRecord) || header.records < 0 ||
+        header.cpus < 1 || header.algorithm < 0 || header.algorithm >= NUMALGORITHMS ||
+        (unsigned long long)header.records > ((unsigned long long)status.st_size - sizeof(header)) / sizeof(struct traceRecord)) {
+        ErrorMsg("'ReadTrace'", "The trace is truncated or of an unknown version");
+        close(fd);
+        return (EXIT_FAILURE);
+    }
+    
+    address = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    busy = calloc((size_t)header.cpus, sizeof(long long));
+    if (address == MAP_FAILED || !busy) {
+        ErrorMsg("'ReadTrace'", "The trace can not be mapped in memory");
+        if (address != MAP_FAILED)
+            munmap(address, (size_t)status.st_size);
+        free(busy);
+        return (EXIT_FAILURE);
+    }
+    madvise(address, (size_t)status.st_size, MADV_SEQUENTIAL);
+    records = (const struct traceRecord *)((const char *)address + sizeof(header));
+    
+    if (decode)
+        printf("start end pid cpu reason\n");
+    
+    for (long long i = 0; i < header.records; i++) {
+        const struct traceRecord *record = &records[i];      /* The record */
+        int reason = record->reason >= 0 && record->reason < NUMREASONS ? record->reason : TRACEFINISHED;
+        
+        if (decode)
+            printf("%lld %lld %d %d %s\n", record->start, record->end, record->pID, record->cpu, reasons[reason]);
+        
+        if (i == 0 || record->start < first)
+            first = record->start;
+        if (i == 0 || record->end > last)
+            last = record->end;
+        if (record->cpu >= 0 && record->cpu < header.cpus)
+            busy[record->cpu] += record->end - record->start;
+        counts[reason]++;
+    }
+    
+    if (!decode) {
+        printf("Algorithm:   %s\n", AlgorithmName(header.algorithm));
+        if (header.algorithm == ROUNDROBIN)
+            printf("Quantum:     %d\n", header.quantum);
+        printf("Records:     %lld\n", header.records);
+        printf("Processes:   %lld\n", counts[TRACEFINISHED]);
+        printf("Start:       %lld\n", first);
+        printf("End:         %lld\n", last);
+        for (int i = 0; i < NUMREASONS; i++)
+            printf("Slices %-10s %lld\n", reasons[i], counts[i]);
+        for (int cpu = 0; cpu < header.cpus; cpu++)
+            printf("CPU %-3d busy: %lld (%.2f%%)\n", cpu, busy[cpu],
+                   last > first ? 100.0 * (double)busy[cpu] / (double)(last - first) : 0.0);
+    }
+    
+    munmap(address, (size_t)status.st_size);
+    free(busy);
+    
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,78 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Trace.h                                                    */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Binary traces with the Gantt chart of a simulation, and the  */
+/*          routines that decode and summarize them                      */
+/*                                                                       */
+/* References:                                                           */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          A trace is read on a machine with the same byte order as the */
+/*          one that wrote it                                            */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 21:00 2026 -- File created                           */
+/*                                                                       */
+/*          Oct  17 23:56 2026 -- The slices that end blocked for I/O    */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          The errors are reported. A trace that can not be written is  */
+/*          closed with a failure                                        */
+/*                                                                       */
+/* Notes:                                                                */
+/*          The trace has a header followed by fixed size records, one   */
+/*          per slice of time that a process spent in a CPU. Two slices  */
+/*          of the same process that follow each other in the same CPU   */
+/*          are merged into one record                                   */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+#define TRACEMAGIC 0x43525447                       /* "GTRC" in a file */
+#define TRACEVERSION 1           /* Version of the format of the trace */
+
+enum traceReasons {TRACEFINISHED = 0, TRACEPREEMPTED, TRACEEXPIRED, TRACEBLOCKED, NUMREASONS};
+
+struct traceHeader{
+    unsigned int magic;                                 /* TRACEMAGIC */
+    unsigned int version;                             /* TRACEVERSION */
+    unsigned int recordSize;       /* Size of the records in bytes */
+    int algorithm;                     /* The algorithm of the trace */
+    int quantum;                        /* Quantum for Round Robin */
+    int cpus;                                      /* Number of CPUs */
+    long long records;                           /* Number of records */
+};
+
+struct traceRecord{
+    long long start;                    /* The process got the CPU */
+    long long end;                      /* The process left the CPU */
+    int pID;                                        /* The process ID */
+    short cpu;                                /* The CPU it ran in */
+    short reason;             /* Why it left the CPU: traceReasons */
+};
+
+struct traceWriter{
+    int fd;                                        /* The trace file */
+    char *buffer;                  /* The records not written yet */
+    size_t length;                        /* Bytes used in the buffer */
+    struct traceHeader header;                /* Header of the trace */
+    struct traceRecord pending;   /* Last slice, which may still grow */
+    int hasPending;                 /* Is there a pending slice? */
+    int failed;                /* Did any write to the file fail? */
+};
+
+int OpenTrace(struct traceWriter *trace, const char *fileName, int algorithm, int quantum, int cpus);
+void TraceSlice(struct traceWriter *trace, long long start, long long end, int pID, int cpu, int reason);
+int CloseTrace(struct traceWriter *trace);
+int ReadTrace(const char *fileName, int decode);
@@ -0,0 +1,131 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Workers.c                                                  */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Pool of worker threads that run independent tasks, used to   */
+/*          execute several simulations at the same time                 */
+/*                                                                       */
+/* References:                                                           */
+/*          POSIX threads                                                */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          The tasks must not share any state that they modify          */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 18:00 2026 - File created                            */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If a thread can not be created, the tasks are run by the     */
+/*          threads that could be created and by the caller              */
+/*                                                                       */
+/* Notes:                                                                */
+/*          Every worker takes the next task that no one has started,    */
+/*          so the long tasks do not hold back the short ones. The       */
+/*          caller works as one more worker while it waits               */
+/*                                                                       */
+/*************************************************************************/
+
+#include <stdlib.h>        /* Used for the memory allocation functions */
+#include <pthread.h>                      /* Used for the worker threads */
+#include <unistd.h>                    /* Used for the function sysconf */
+#include "Workers.h"                                   /* Function header */
+
+struct workers{
+    pthread_mutex_t lock;                  /* Protects the next task */
+    int next;                              /* First task not started */
+    int tasks;                                  /* Number of tasks */
+    workerTask run;                         /* Runs one of the tasks */
+    void *data;                     /* Information used by the tasks */
+};
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: NumberOfCPUs                                               */
+/*                                                                       */
+/*  Purpose: Tells how many processors can run the workers               */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   None                                             */
+/*                                                                       */
+/*            Output:   The number of processors, at least one           */
+/*                                                                       */
+/*************************************************************************/
+int NumberOfCPUs(){
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);      /* Processors online */
+    
+    return (cpus > 0 ? (int)cpus : 1);
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: Work                                                       */
+/*                                                                       */
+/*  Purpose: Runs the tasks that have not been started, one at a time,   */
+/*           until none is left                                          */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The workers                                      */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+static void *Work(void *data){
+    struct workers *workers = data;                      /* The workers */
+    int task;                                       /* The task to run */
+    
+    for (;;) {
+        pthread_mutex_lock(&workers->lock);
+        task = workers->next < workers->tasks ? workers->next++ : -1;
+        pthread_mutex_unlock(&workers->lock);
+        
+        if (task == -1)
+            return NULL;
+        workers->run(workers->data, task);
+    }
+}
+
+/*************************************************************************/
+/*                                                                       */
+/*  Function: RunWorkers                                                 */
+/*                                                                       */
+/*  Purpose: Runs a number of tasks over a pool of threads and waits     */
+/*           until all of them have finished                             */
+/*                                                                       */
+/*  Parameters:                                                          */
+/*            Input :   The number of threads, including the caller, the */
+/*                      number of tasks, the function that runs a task   */
+/*                      and the data that it receives                    */
+/*                                                                       */
+/*            Output:   None                                             */
+/*                                                                       */
+/*************************************************************************/
+void RunWorkers(int threads, int tasks, workerTask run, void *data){
+    struct workers workers = {.next = 0, .tasks = tasks, .run = run, .data = data};
+    pthread_t *ids = NULL;                   /* The threads created */
+    int created = 0;                      /* How many were created */
+    
+    /* There is no point in having more threads than tasks */
+    if (threads > tasks)
+        threads = tasks;
+    
+    pthread_mutex_init(&workers.lock, NULL);
+    
+    if (threads > 1 && (ids = malloc((size_t)(threads - 1) * sizeof(pthread_t))))
+        while (created < threads - 1 && pthread_create(&ids[created], NULL, Work, &workers) == 0)
+            created++;
+    
+    /* The caller is one more worker */
+    Work(&workers);
+    
+    for (int i = 0; i < created; i++)
+        pthread_join(ids[i], NULL);
+    
+    free(ids);
+    pthread_mutex_destroy(&workers.lock);
+}
@@ -0,0 +1,41 @@
+/*************************************************************************/
+/*                                                                       */
+/* Copyright (c) 2026 Mario García Navarro. All rights reserved.         */
+/*                                                                       */
+/* File name: Workers.h                                                  */
+/*                                                                       */
+/* Author:                                                               */
+/*          Mario García Navarro                                         */
+/*                                                                       */
+/* Purpose:                                                              */
+/*          Pool of worker threads that run independent tasks, used to   */
+/*          execute several simulations at the same time                 */
+/*                                                                       */
+/* References:                                                           */
+/*          POSIX threads                                                */
+/*                                                                       */
+/* Restrictions:                                                         */
+/*          The tasks must not share any state that they modify          */
+/*                                                                       */
+/* Revision history:                                                     */
+/*          Oct  17 18:00 2026 -- File created                           */
+/*                                                                       */
+/* Error handling:                                                       */
+/*          If a thread can not be created, the tasks are run by the     */
+/*          threads that could be created and by the caller              */
+/*                                                                       */
+/* Notes:                                                                */
+/*          Every worker takes the next task that no one has started,    */
+/*          so the long tasks do not hold back the short ones            */
+/*                                                                       */
+/*************************************************************************/
+
+
+/************************************************************************/
+/*                  Declare the function prototypes                     */
+/************************************************************************/
+
+typedef void (*workerTask)(void *data, int task);    /* Runs one task */
+
+int NumberOfCPUs();
+void RunWorkers(int threads, int tasks, workerTask run, void *data);